@@ -610,8 +610,15 @@ public:
   insert_diff_node(const diff *d,
 		   const type_or_decl_base_sptr& impacted_iface);
 
+  void
+  insert_impacted_interface(const diff *d,
+			    const type_or_decl_base_sptr& impacted_iface);
+
   artifact_sptr_set_type*
   lookup_impacted_interfaces(const diff *d) const;
+
+  void
+  clear();
 }; // end class diff_maps
 
 /// A convenience typedef for a shared pointer to @ref corpus_diff.
@@ -759,6 +766,9 @@ public:
   void
   maybe_apply_filters(corpus_diff_sptr diff);
 
+  void
+  maybe_apply_filters(const diff_ptrs_type& diffs);
+
   const suppr::suppressions_type&
   suppressions() const;
 
@@ -777,6 +787,18 @@ public:
   void
   add_suppressions(const suppr::suppressions_type& supprs);
 
+  bool
+  suppression_verdicts_are_reusable() const;
+
+  bool
+  lookup_suppression_verdict(const diff* d, diff_category& verdict) const;
+
+  void
+  record_suppression_verdict(const diff* d, diff_category verdict);
+
+  size_t
+  get_number_of_suppression_verdict_hits() const;
+
   bool
   perform_change_categorization() const;
 
@@ -2635,6 +2657,9 @@ public:
   const diff_stats&
   apply_filters_and_suppressions_before_reporting();
 
+  const diff_stats&
+  reapply_filters_and_suppressions();
+
   void
   mark_leaf_diff_nodes();
 
@@ -2955,6 +2980,9 @@ propagate_categories(corpus_diff* diff_tree);
 void
 propagate_categories(corpus_diff_sptr diff_tree);
 
+void
+propagate_categories(const diff_ptrs_type& diff_trees);
+
 void
 apply_suppressions(diff* diff_tree);
 
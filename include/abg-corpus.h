@@ -311,6 +311,9 @@ public:
   exported_decls_builder_sptr
   get_exported_decls_builder() const;
 
+  void
+  record_memory_stats(memory_stats_type& stats) const;
+
   friend class type_base;
   friend class corpus_group;
 };// end class corpus.
@@ -28,6 +28,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "abg-fwd.h"
 
@@ -2006,6 +2007,125 @@ compute_diff(RandomAccessOutputIterator a_begin,
 							       ses);
 }
 
+/// Compute an edit script from transforming a sequence into another
+/// one, by matching the elements of the two sequences using a key.
+///
+/// Unlike the O(ND) algorithm of compute_diff, which degrades badly
+/// as the number of differences grows, this is a hash join which
+/// runs in time proportional to the sizes of the two sequences.  It's
+/// meant for sequences in which the relative order of the elements
+/// doesn't carry any meaning, like sets of functions or of ELF
+/// symbols.
+///
+/// An element of the first sequence is matched with an element of
+/// the second sequence that shares one of its keys and that is equal
+/// to it.  The keys of an element of the first sequence are tried in
+/// order.  The elements of the first sequence that are not matched are
+/// deletions and the elements of the second sequence that are not
+/// matched are insertions.  Each run of unmatched elements of the
+/// second sequence is inserted after the element of the first
+/// sequence that is matched with the element preceding the run.
+///
+/// @tparm RandomAccessOutputIterator the type of iterators passed to
+/// this function.  It must be a random access output iterator kind.
+///
+/// @tparm EqualityFunctor this must be a class that declares a public
+/// call operator member returning a boolean and taking two arguments
+/// that must be of the same type as the one pointed to by the @ref
+/// RandomAccessOutputIterator template parameter.
+///
+/// @tparm KeyFunctor this must be a class that declares a public call
+/// operator member taking an argument that must be of the same type
+/// as the one pointed to by the @ref RandomAccessOutputIterator
+/// template parameter, and a vector of std::string to which it
+/// appends the keys of that argument.  An element can have several
+/// keys, e.g, one per alias of its ELF symbol.  Elements that are
+/// equal must share at least one key; otherwise they are reported as
+/// a deletion and an insertion.
+///
+/// @param a_begin an iterator to the beginning of the first sequence
+/// to consider.
+///
+/// @param a_end an iterator to the end of the first sequence to
+/// consider.
+///
+/// @param b_begin an iterator to the beginning of the second sequence
+/// to consider.
+///
+/// @param b_end an iterator to the end of the second sequence to
+/// consider.
+///
+/// @param ses the resulting edit script.
+template<typename RandomAccessOutputIterator,
+	 typename EqualityFunctor,
+	 typename KeyFunctor>
+void
+compute_keyed_diff(RandomAccessOutputIterator a_begin,
+		   RandomAccessOutputIterator a_end,
+		   RandomAccessOutputIterator b_begin,
+		   RandomAccessOutputIterator b_end,
+		   edit_script& ses)
+{
+  EqualityFunctor eq;
+  KeyFunctor key;
+
+  int a_size = a_end - a_begin;
+  int b_size = b_end - b_begin;
+
+  vector<string> keys;
+  std::unordered_map<string, vector<int> > b_indexes_per_key;
+  for (int j = 0; j < b_size; ++j)
+    {
+      keys.clear();
+      key(b_begin[j], keys);
+      for (const string& k : keys)
+	{
+	  vector<int>& indexes = b_indexes_per_key[k];
+	  // An element might yield the same key twice.
+	  if (indexes.empty() || indexes.back() != j)
+	    indexes.push_back(j);
+	}
+    }
+
+  // For each element of the second sequence, the index of the
+  // element of the first sequence it's matched with, or -1.
+  vector<int> b_matches(b_size, -1);
+  for (int i = 0; i < a_size; ++i)
+    {
+      bool matched = false;
+      keys.clear();
+      key(a_begin[i], keys);
+      for (auto k = keys.begin(); !matched && k != keys.end(); ++k)
+	{
+	  auto it = b_indexes_per_key.find(*k);
+	  if (it == b_indexes_per_key.end())
+	    continue;
+	  for (int j : it->second)
+	    if (b_matches[j] < 0 && eq(a_begin[i], b_begin[j]))
+	      {
+		b_matches[j] = i;
+		matched = true;
+		break;
+	      }
+	}
+      if (!matched)
+	ses.deletions().push_back(deletion(i));
+    }
+
+  int insertion_point = -1;
+  for (int j = 0; j < b_size; ++j)
+    {
+      if (b_matches[j] >= 0)
+	{
+	  insertion_point = b_matches[j];
+	  continue;
+	}
+      if (j == 0 || b_matches[j - 1] >= 0)
+	ses.insertions().push_back(insertion(insertion_point));
+      ses.insertions().back().inserted_indexes().push_back(j);
+    }
+}
+
 void
 compute_lcs(const char* str1, const char* str2, int &ses_len, string& lcs);
 
@@ -94,6 +94,9 @@ class reader : public fe_iface
   const Dwarf*
   dwarf_debug_info() const;
 
+  const string&
+  dwarf_debug_info_path() const;
+
   bool
   has_dwarf_debug_info() const;
 
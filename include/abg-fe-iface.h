@@ -114,6 +114,9 @@ protected:
   void
   add_suppressions(const suppr::suppressions_type&);
 
+  const suppr::suppressions_index&
+  suppressions_index() const;
+
   corpus_sptr
   corpus();
 
@@ -147,6 +150,9 @@ protected:
   void
   add_var_to_exported_or_undefined_decls(const var_decl_sptr& var);
 
+  virtual void
+  record_memory_stats(ir::memory_stats_type& stats) const;
+
   virtual ir::corpus_sptr
   read_corpus(status& status) = 0;
 }; //end class fe_iface
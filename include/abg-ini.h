@@ -155,6 +155,8 @@ public:
 
   virtual const string&
   as_string() const;
+
+  virtual ~list_property_value();
 }; // end class list_property_value
 
 list_property_value*
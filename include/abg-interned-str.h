@@ -241,6 +241,12 @@ public:
   const char*
   get_string(const char* s) const;
 
+  size_t
+  get_number_of_strings() const;
+
+  size_t
+  get_approximate_size() const;
+
   ~interned_string_pool();
 }; // end class interned_string_pool
 
@@ -19,6 +19,7 @@
 #include <stdint.h>
 #include <cstdlib>
 #include <functional>
+#include <map>
 #include <set>
 #include <unordered_map>
 #include "abg-cxx-compat.h"
@@ -130,6 +131,62 @@ void
 sort_types(const canonical_type_sptr_set_type& types,
 	   vector<type_base_sptr>& result);
 
+/// The approximate amount of memory used by a given kind of
+/// artifact, be it an IR node, an interned string or an entry of a
+/// side table.
+struct memory_usage
+{
+  /// The number of instances of the artifact.
+  size_t count;
+  /// The approximate number of bytes used by these instances.
+  size_t bytes;
+
+  memory_usage()
+    : count(), bytes()
+  {}
+
+  /// Account for new instances of the artifact.
+  ///
+  /// @param c the number of new instances.
+  ///
+  /// @param b the approximate number of bytes used by the new
+  /// instances.
+  void
+  add(size_t c, size_t b)
+  {
+    count += c;
+    bytes += b;
+  }
+}; // end struct memory_usage
+
+/// A map that associates the name of a kind of artifact to the
+/// approximate amount of memory used by its instances.
+///
+/// The map is sorted by name so that memory reports are stable.
+typedef std::map<string, memory_usage> memory_stats_type;
+
+/// Compute the approximate number of bytes used by a hash-based
+/// container, that is, by its nodes and by its bucket array.
+///
+/// The memory owned by the elements themselves (e.g, the characters
+/// of a string or the pointee of a shared pointer) is not accounted
+/// for.
+///
+/// @param c the hash-based container to consider.
+///
+/// @return the approximate number of bytes used by @p c.
+template<typename HashContainer>
+size_t
+get_approximate_hash_container_size(const HashContainer& c)
+{
+  return (c.size() * (sizeof(typename HashContainer::value_type)
+		      + sizeof(void*))
+	  + c.bucket_count() * sizeof(void*));
+}
+
+void
+dump_memory_stats(const memory_stats_type& stats, std::ostream& o);
+
 /// This is an abstraction of the set of resources necessary to manage
 /// several aspects of the internal representations of the Abigail
 /// library.
@@ -286,6 +343,9 @@ public:
   get_canonical_type_from_type_id(const char*) const;
 #endif
 
+  void
+  record_memory_stats(memory_stats_type& stats) const;
+
   friend class class_or_union;
   friend class class_decl;
   friend class function_type;
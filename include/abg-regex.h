@@ -62,6 +62,12 @@ compile(const std::string& str);
 bool
 match(const regex_t_sptr& r, const std::string& str);
 
+bool
+get_literal_prefix(const std::string& r, std::string& prefix, bool& is_exact);
+
+bool
+get_literal_suffix(const std::string& r, std::string& suffix);
+
 }// end namespace regex
 
 namespace sptr_utils
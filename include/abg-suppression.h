@@ -650,6 +650,12 @@ public:
   void
   set_symbol_name_not_regex_str(const string&);
 
+  const unordered_set<string>&
+  get_symbol_name_not_in_set() const;
+
+  void
+  set_symbol_name_not_in_set(const unordered_set<string>&);
+
   const string&
   get_symbol_version() const;
 
@@ -841,6 +847,12 @@ public:
   void
   set_symbol_name_not_regex_str(const string&);
 
+  const unordered_set<string>&
+  get_symbol_name_not_in_set() const;
+
+  void
+  set_symbol_name_not_in_set(const unordered_set<string>&);
+
   const string&
   get_symbol_version() const;
 
@@ -939,6 +951,58 @@ file_suppression_sptr
 file_is_suppressed(const string& file_path,
 		   const suppressions_type& suppressions);
 
+/// An index of a set of suppression specifications.
+///
+/// Given the name of a function, a variable or a type, the index
+/// yields the subset of the indexed suppression specifications that
+/// can possibly match that name.  Exact names are looked up in hash
+/// tables, regular expressions that have a literal prefix or suffix
+/// are pre-filtered by comparing that literal, and the other
+/// specifications are always part of the result.
+///
+/// The suppression specifications returned must still be fully
+/// evaluated against the artifact; the index just avoids evaluating
+/// the ones that cannot match.  They are returned in the order in
+/// which they appear in the indexed set.
+class suppressions_index
+{
+  struct priv;
+  std::unique_ptr<priv> priv_;
+
+public:
+  suppressions_index();
+
+  suppressions_index(const suppressions_type&);
+
+  ~suppressions_index();
+
+  void
+  index_suppressions(const suppressions_type&);
+
+  const suppressions_type&
+  get_suppressions() const;
+
+  bool
+  has_function_suppressions() const;
+
+  bool
+  has_variable_suppressions() const;
+
+  void
+  get_function_suppressions(const string& fn_name,
+			    const string& fn_linkage_name,
+			    vector<function_suppression_sptr>& result) const;
+
+  void
+  get_variable_suppressions(const string& var_name,
+			    const string& var_linkage_name,
+			    vector<variable_suppression_sptr>& result) const;
+
+  void
+  get_type_suppressions(const string& type_name,
+			vector<type_suppression_sptr>& result) const;
+}; // end class suppressions_index
+
 bool
 suppression_matches_soname(const string& soname,
 			   const suppression_base& suppr);
@@ -961,6 +1025,10 @@ bool
 suppression_can_match(const fe_iface&,
 		      const suppression_base&);
 
+bool
+suppression_can_match(const comparison::diff_context&,
+		      const suppression_base&);
+
 bool
 suppression_matches_function_name(const fe_iface&,
 				  const suppr::function_suppression&,
@@ -48,18 +48,26 @@ using std::static_pointer_cast;
 using abigail::sptr_utils::noop_deleter;
 
 /// Convenience typedef for a pair of decls or types.
-typedef std::pair<const type_or_decl_base_sptr,
-		  const type_or_decl_base_sptr> types_or_decls_type;
+///
+/// The decls or types are designated by their address.  They are kept
+/// alive by the diff node that is associated to the pair, which holds
+/// them as its subjects.
+typedef std::pair<const type_or_decl_base*,
+		  const type_or_decl_base*> types_or_decls_type;
 
 /// A hashing functor for @ref types_or_decls_type.
+///
+/// As two pairs of decls or types are equal iff they designate the
+/// same IR nodes, the hash value is computed from the addresses of
+/// the nodes.  This is much cheaper than hashing their structure.
 struct types_or_decls_hash
 {
   size_t
   operator()(const types_or_decls_type& d) const
   {
-    size_t h1 = hash_type_or_decl(d.first);
-    size_t h2 = hash_type_or_decl(d.second);
-    return *hashing::combine_hashes(hash_t(h1), hash_t(h2));
+    std::hash<const type_or_decl_base*> hash_ptr;
+    return *hashing::combine_hashes(hash_t(hash_ptr(d.first)),
+				    hash_t(hash_ptr(d.second)));
   }
 };
 
@@ -171,6 +179,9 @@ struct diff_context::priv
   diff_category			allowed_category_;
   reporter_base_sptr			reporter_;
   types_or_decls_diff_map_type		types_or_decls_diff_map;
+  // The keys of types_or_decls_diff_map that are not the subjects of
+  // the diff node they are associated to are kept alive here.
+  vector<type_or_decl_base_sptr>	live_diff_keys_;
   unordered_diff_sptr_set		live_diffs_;
   vector<diff_sptr>			canonical_diffs;
   vector<filtering::filter_base_sptr>	filters_;
@@ -185,6 +196,24 @@ struct diff_context::priv
   // suppressions_ are stored here.  Each time suppressions_ is
   // modified, this data member should be cleared.
   suppressions_type			direct_suppressions_;
+  // These are true iff negated_suppressions_ and
+  // direct_suppressions_ have been computed from suppressions_,
+  // even if they turned out to be empty.
+  bool					negated_suppressions_computed_;
+  bool					direct_suppressions_computed_;
+  // The verdicts of the suppression specifications of suppressions_
+  // on the diff nodes of pairs of canonical types.  Each time
+  // suppressions_ is modified, this data member should be cleared.
+  unordered_map<types_or_decls_type, diff_category,
+		types_or_decls_hash, types_or_decls_equal>
+					suppression_verdicts_;
+  mutable size_t			num_suppression_verdict_hits_;
+  // True iff the verdicts of suppressions_ on a diff node of types
+  // only depend on the canonical types of its subjects, so that they
+  // can be recorded in suppression_verdicts_.  This is not the case
+  // if a type suppression looks at the source location of the types.
+  mutable bool				suppression_verdicts_reusable_;
+  mutable bool				suppression_verdicts_reusable_computed_;
   pointer_map				visited_diff_nodes_;
   corpus_diff_sptr			corpus_diff_;
   ostream*				default_output_stream_;
@@ -218,6 +247,11 @@ struct diff_context::priv
   priv()
     : allowed_category_(EVERYTHING_CATEGORY),
       reporter_(),
+      negated_suppressions_computed_(),
+      direct_suppressions_computed_(),
+      num_suppression_verdict_hits_(),
+      suppression_verdicts_reusable_(),
+      suppression_verdicts_reusable_computed_(),
       default_output_stream_(),
       error_output_stream_(),
       perform_change_categorization_(true),
@@ -1043,6 +1077,80 @@ struct elf_symbol_comp
   {return operator()(l.get(), r.get());}
 }; //end struct elf_symbol_comp
 
+/// The functor used to get the keys by which the unreferenced ELF
+/// symbols of two corpora are matched when computing the diff of the
+/// corpora, using diff_utils::compute_keyed_diff.
+///
+/// Two symbols are equal if one of them is textually equal to the
+/// other one or to one of its aliases.  So the keys of a symbol are
+/// the ID string of the symbol, followed by the ID strings of its
+/// aliases, starting with its main symbol.  This way, a symbol whose
+/// alias became the main symbol is still matched with its
+/// counterpart.
+struct elf_symbol_diff_key
+{
+  void
+  operator()(const elf_symbol& s, vector<string>& keys) const
+  {
+    keys.push_back(s.get_id_string());
+    elf_symbol_sptr m = s.get_main_symbol();
+    if (!m)
+      return;
+    if (m.get() != &s)
+      keys.push_back(m->get_id_string());
+    for (elf_symbol_sptr a = m->get_next_alias();
+	 a && !a->is_main_symbol();
+	 a = a->get_next_alias())
+      if (a.get() != &s)
+	keys.push_back(a->get_id_string());
+  }
+
+  void
+  operator()(const elf_symbol_sptr& s, vector<string>& keys) const
+  {operator()(*s, keys);}
+}; // end struct elf_symbol_diff_key
+
+/// The functor used to get the keys by which the functions of two
+/// corpora are matched when computing the diff of the corpora, using
+/// diff_utils::compute_keyed_diff.
+///
+/// Two functions that have an ELF symbol are equal only if their
+/// symbols alias, whatever their names are.  So the keys of such a
+/// function are those of its symbol.  Two functions without ELF
+/// symbol are equal only if they have the same name.
+struct function_decl_diff_key
+{
+  void
+  operator()(const function_decl* f, vector<string>& keys) const
+  {
+    if (elf_symbol_sptr s = f->get_symbol())
+      elf_symbol_diff_key()(*s, keys);
+    else
+      keys.push_back(f->get_name());
+  }
+}; // end struct function_decl_diff_key
+
+/// The functor used to get the keys by which the variables of two
+/// corpora are matched when computing the diff of the corpora, using
+/// diff_utils::compute_keyed_diff.
+///
+/// Two variables that have an ELF symbol are equal only if their
+/// symbols are textually equal, whatever their names are.  So the
+/// key of such a variable is the ID string of its symbol.  Two
+/// variables without ELF symbol are equal only if they have the same
+/// name.
+struct var_decl_diff_key
+{
+  void
+  operator()(const var_decl_sptr& v, vector<string>& keys) const
+  {
+    if (elf_symbol_sptr s = v->get_symbol())
+      keys.push_back(s->get_id_string());
+    else
+      keys.push_back(v->get_name());
+  }
+}; // end struct var_decl_diff_key
+
 struct typedef_diff::priv
 {
   diff_sptr underlying_type_diff_;
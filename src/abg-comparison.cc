@@ -1140,7 +1140,8 @@ diff_context::has_diff_for(const type_or_decl_base_sptr first,
 			   const type_or_decl_base_sptr second) const
 {
   types_or_decls_diff_map_type::const_iterator i =
-    priv_->types_or_decls_diff_map.find(std::make_pair(first, second));
+    priv_->types_or_decls_diff_map.find(std::make_pair(first.get(),
+						       second.get()));
   if (i != priv_->types_or_decls_diff_map.end())
     return i->second;
   return diff_sptr();
@@ -1233,7 +1234,17 @@ void
 diff_context::add_diff(type_or_decl_base_sptr first,
 		       type_or_decl_base_sptr second,
 		       const diff_sptr d)
-{priv_->types_or_decls_diff_map[std::make_pair(first, second)] = d;}
+{
+  priv_->types_or_decls_diff_map[std::make_pair(first.get(),
+						second.get())] = d;
+
+  // The map only holds the addresses of the decls, so make sure they
+  // live as long as the map entry.
+  if (d && first != d->first_subject())
+    priv_->live_diff_keys_.push_back(first);
+  if (d && second != d->second_subject())
+    priv_->live_diff_keys_.push_back(second);
+}
 
 /// Add a diff tree node to the cache of the current diff_context
 ///
@@ -1565,6 +1576,63 @@ diff_context::maybe_apply_filters(corpus_diff_sptr diff)
     }
 }
 
+/// Apply the diff filters to a set of diff sub-trees, in one go.
+///
+/// This is equivalent to invoking @ref maybe_apply_filters on each
+/// sub-tree of @p diffs, except that the nodes shared by several
+/// sub-trees (e.g, the diff nodes of types used by several functions)
+/// are categorized, and have their categories propagated, only once
+/// per filter, rather than once per sub-tree.
+///
+/// @param diffs the diff sub-trees to apply the filters to.
+void
+diff_context::maybe_apply_filters(const diff_ptrs_type& diffs)
+{
+  diff_ptrs_type changed_diffs;
+  for (auto d : diffs)
+    if (d && d->has_changes())
+      changed_diffs.push_back(d);
+
+  if (changed_diffs.empty())
+    return;
+
+  for (const auto& f : diff_filters())
+    {
+      tools_utils::timer t;
+      if (do_log())
+	{
+	  std::cerr << "applying a filter to "
+		    << changed_diffs.size()
+		    << " diff sub-trees ...\n";
+	  t.start();
+	}
+
+      bool s = visiting_a_node_twice_is_forbidden();
+      forbid_visiting_a_node_twice(true);
+      forget_visited_diffs();
+      for (auto d : changed_diffs)
+	d->traverse(*f);
+      forbid_visiting_a_node_twice(s);
+
+      if (do_log())
+	{
+	  t.stop();
+	  std::cerr << "filter applied!:" << t << "\n";
+
+	  std::cerr << "propagating categories for the same diff sub-trees ... \n";
+	  t.start();
+	}
+
+      propagate_categories(changed_diffs);
+
+      if (do_log())
+	{
+	  t.stop();
+	  std::cerr << "category propagated!: " << t << "\n";
+	}
+    }
+}
+
 /// Getter for the vector of suppressions that specify which diff node
 /// reports should be dropped on the floor.
 ///
@@ -1584,6 +1652,10 @@ diff_context::suppressions()
   // from priv_->suppressions_;
   priv_->negated_suppressions_.clear();
   priv_->direct_suppressions_.clear();
+  priv_->negated_suppressions_computed_ = false;
+  priv_->direct_suppressions_computed_ = false;
+  priv_->suppression_verdicts_.clear();
+  priv_->suppression_verdicts_reusable_computed_ = false;
   return priv_->suppressions_;
 }
 
@@ -1603,10 +1675,13 @@ diff_context::suppressions()
 const suppr::suppressions_type&
 diff_context::negated_suppressions() const
 {
-  if (priv_->negated_suppressions_.empty())
-    for (auto s : suppressions())
-      if (is_negated_suppression(s))
-	priv_->negated_suppressions_.push_back(s);
+  if (!priv_->negated_suppressions_computed_)
+    {
+      for (auto s : suppressions())
+	if (is_negated_suppression(s))
+	  priv_->negated_suppressions_.push_back(s);
+      priv_->negated_suppressions_computed_ = true;
+    }
 
   return priv_->negated_suppressions_;
 }
@@ -1626,11 +1701,12 @@ diff_context::negated_suppressions() const
 const suppr::suppressions_type&
 diff_context::direct_suppressions() const
 {
-   if (priv_->direct_suppressions_.empty())
+   if (!priv_->direct_suppressions_computed_)
     {
       for (auto s : suppressions())
 	if (!is_negated_suppression(s))
 	  priv_->direct_suppressions_.push_back(s);
+      priv_->direct_suppressions_computed_ = true;
     }
    return priv_->direct_suppressions_;
 }
@@ -1648,6 +1724,10 @@ diff_context::add_suppression(const suppression_sptr suppr)
   // from priv_->suppressions_;
   priv_->negated_suppressions_.clear();
   priv_->direct_suppressions_.clear();
+  priv_->negated_suppressions_computed_ = false;
+  priv_->direct_suppressions_computed_ = false;
+  priv_->suppression_verdicts_.clear();
+  priv_->suppression_verdicts_reusable_computed_ = false;
 }
 
 /// Add new suppression specifications that specify which diff node
@@ -1660,8 +1740,160 @@ diff_context::add_suppressions(const suppressions_type& supprs)
 {
   priv_->suppressions_.insert(priv_->suppressions_.end(),
 			      supprs.begin(), supprs.end());
+  // Invalidate negated and direct suppressions caches that are built
+  // from priv_->suppressions_;
+  priv_->negated_suppressions_.clear();
+  priv_->direct_suppressions_.clear();
+  priv_->negated_suppressions_computed_ = false;
+  priv_->direct_suppressions_computed_ = false;
+  priv_->suppression_verdicts_.clear();
+  priv_->suppression_verdicts_reusable_computed_ = false;
+}
+
+/// Get the canonical types of the subjects of a diff node of two
+/// types.
+///
+/// @param d the diff node to consider.
+///
+/// @param first output parameter.  This is set to the canonical type
+/// of the first subject of @p d.
+///
+/// @param second output parameter.  This is set to the canonical
+/// type of the second subject of @p d.
+///
+/// @return true iff both subjects of @p d are types that have a
+/// canonical type.
+static bool
+get_canonical_subject_types(const diff* d,
+			    const type_base*& first,
+			    const type_base*& second)
+{
+  first = is_type(d->first_subject().get());
+  second = is_type(d->second_subject().get());
+  if (first)
+    first = first->get_naked_canonical_type();
+  if (second)
+    second = second->get_naked_canonical_type();
+  return first && second;
+}
+
+/// Test if the verdict of a suppression specification on a diff node
+/// of types might depend on the source location of the subjects of
+/// the diff node.
+///
+/// That is the case of the type suppressions that have a
+/// "source_location_not_in" or a "source_location_not_regexp"
+/// property, and of the artificial type suppressions that are
+/// generated from the public headers given by the user.  Two
+/// equivalent types that are defined in different headers would
+/// have the same canonical type, but not the same verdict.
+///
+/// @param s the suppression specification to consider.
+///
+/// @return true iff the verdict of @p s on a diff node of types might
+/// depend on the source location of the types.
+static bool
+suppression_depends_on_type_location(const suppression_sptr& s)
+{
+  if (type_suppression_sptr ts = is_type_suppression(s))
+    return (ts->get_is_artificial()
+	    || !ts->get_source_locations_to_keep().empty()
+	    || !ts->get_source_location_to_keep_regex_str().empty());
+  return false;
 }
 
+/// Test if the verdicts of the suppression specifications of this
+/// context on the diff nodes of types can be recorded, keyed by the
+/// canonical types of the subjects of the diff nodes.
+///
+/// @return true iff no suppression specification of this context
+/// depends on the source location of the types it evaluates.
+bool
+diff_context::suppression_verdicts_are_reusable() const
+{
+  if (!priv_->suppression_verdicts_reusable_computed_)
+    {
+      priv_->suppression_verdicts_reusable_ = true;
+      for (auto& s : priv_->suppressions_)
+	if (suppression_depends_on_type_location(s))
+	  {
+	    priv_->suppression_verdicts_reusable_ = false;
+	    break;
+	  }
+      priv_->suppression_verdicts_reusable_computed_ = true;
+    }
+  return priv_->suppression_verdicts_reusable_;
+}
+
+/// Look up the verdict of the suppression specifications of this
+/// context on a given diff node.
+///
+/// Verdicts are recorded for the diff nodes of two types, keyed by
+/// the canonical types of their subjects.  So once a diff node of two
+/// types has been evaluated against the suppression specifications,
+/// the other diff nodes of equivalent types don't need to be.
+///
+/// Verdicts are not recorded at all if a suppression specification
+/// looks at the source location of types; see
+/// diff_context::suppression_verdicts_are_reusable.
+///
+/// @param d the diff node to consider.
+///
+/// @param verdict output parameter.  This is set to the verdict
+/// recorded for @p d, iff this function returns true.  The verdict is
+/// a bitmap of the SUPPRESSED_CATEGORY, PRIVATE_TYPE_CATEGORY and
+/// HAS_ALLOWED_CHANGE_CATEGORY categories.
+///
+/// @return true iff a verdict was recorded for @p d.
+bool
+diff_context::lookup_suppression_verdict(const diff* d,
+					 diff_category& verdict) const
+{
+  const type_base *first = 0, *second = 0;
+  if (!suppression_verdicts_are_reusable()
+      || !get_canonical_subject_types(d, first, second))
+    return false;
+
+  auto i = priv_->suppression_verdicts_.find(types_or_decls_type(first,
+								 second));
+  if (i == priv_->suppression_verdicts_.end())
+    return false;
+
+  verdict = i->second;
+  ++priv_->num_suppression_verdict_hits_;
+  return true;
+}
+
+/// Record the verdict of the suppression specifications of this
+/// context on a given diff node.
+///
+/// Nothing is recorded if the subjects of the diff node are not
+/// types that have canonical types, or if the verdicts of the
+/// suppression specifications of this context are not reusable.
+///
+/// @param d the diff node to consider.
+///
+/// @param verdict the verdict to record for @p d.  See
+/// diff_context::lookup_suppression_verdict for its format.
+void
+diff_context::record_suppression_verdict(const diff* d,
+					 diff_category verdict)
+{
+  const type_base *first = 0, *second = 0;
+  if (suppression_verdicts_are_reusable()
+      && get_canonical_subject_types(d, first, second))
+    priv_->suppression_verdicts_[types_or_decls_type(first, second)] =
+      verdict;
+}
+
+/// Getter of the number of times a verdict of the suppression
+/// specifications was found by diff_context::lookup_suppression_verdict.
+///
+/// @return the number of suppression verdicts that were re-used.
+size_t
+diff_context::get_number_of_suppression_verdict_hits() const
+{return priv_->num_suppression_verdict_hits_;}
+
 /// Test if it's requested to perform diff node categorization.
 ///
 /// @return true iff it's requested to perform diff node
@@ -2438,13 +2670,16 @@ diff::traverse(diff_node_visitor& v)
 /// Sets a flag saying if a report has already been emitted for the
 /// current diff.
 ///
+/// The flag is set on the canonical diff of the current diff too, if
+/// it has one.
+///
 /// @param f true if a report has already been emitted for the
 /// current diff, false otherwise.
 void
 diff::reported_once(bool f) const
 {
-  ABG_ASSERT(priv_->canonical_diff_);
-  priv_->canonical_diff_->priv_->reported_once_ = f;
+  if (priv_->canonical_diff_)
+    priv_->canonical_diff_->priv_->reported_once_ = f;
   priv_->reported_once_ = f;
 }
 
@@ -2597,12 +2832,15 @@ diff::set_local_category(diff_category c)
 bool
 diff::is_filtered_out() const
 {
+  // Note that the tests on the category bit-map of the canonical
+  // node are performed before looking at the negated suppressions,
+  // as walking these is much more expensive.
   if (diff * canonical = get_canonical_diff())
     if ((canonical->get_category() & SUPPRESSED_CATEGORY
 	 || canonical->get_category() & PRIVATE_TYPE_CATEGORY)
-	&& !canonical->is_allowed_by_specific_negated_suppression()
 	&& !canonical->has_descendant_allowed_by_specific_negated_suppression()
-	&& !canonical->has_parent_allowed_by_specific_negated_suppression())
+	&& !canonical->has_parent_allowed_by_specific_negated_suppression()
+	&& !canonical->is_allowed_by_specific_negated_suppression())
       // The canonical type was suppressed either by a user-provided
       // suppression specification or by a "private-type" suppression
       // specification..  This means all the classes of equivalence of
@@ -2681,9 +2919,20 @@ diff::is_suppressed() const
 bool
 diff::is_suppressed(bool &is_private_type) const
 {
+  // The suppression specifications might have been evaluated already
+  // on a diff node of equivalent types.
+  diff_category verdict = NO_CHANGE_CATEGORY;
+  if (context()->lookup_suppression_verdict(this, verdict))
+    {
+      if (verdict & PRIVATE_TYPE_CATEGORY)
+	is_private_type = true;
+      return verdict & (SUPPRESSED_CATEGORY | PRIVATE_TYPE_CATEGORY);
+    }
+
   // If there is at least one negated suppression, then suppress the
   // current diff node by default ...
   bool do_suppress = !context()->negated_suppressions().empty();
+  bool is_allowed = false, is_private = false;
 
   // ... unless there is at least one negated suppression that
   // specifically asks to keep this diff node around (un-suppressed).
@@ -2691,6 +2940,7 @@ diff::is_suppressed(bool &is_private_type) const
     if (!n->suppresses_diff(this))
       {
 	do_suppress = false;
+	is_allowed = true;
 	break;
       }
 
@@ -2702,10 +2952,18 @@ diff::is_suppressed(bool &is_private_type) const
       {
 	do_suppress = true;
 	if (is_opaque_type_suppr_spec(d))
-	  is_private_type = true;
+	  is_private = true;
 	break;
       }
 
+  if (do_suppress)
+    verdict |= is_private ? PRIVATE_TYPE_CATEGORY : SUPPRESSED_CATEGORY;
+  if (is_allowed)
+    verdict |= HAS_ALLOWED_CHANGE_CATEGORY;
+  context()->record_suppression_verdict(this, verdict);
+
+  if (is_private)
+    is_private_type = true;
   return do_suppress;
 }
 
@@ -2755,15 +3013,13 @@ diff::has_local_changes_to_be_reported() const
 bool
 diff::is_allowed_by_specific_negated_suppression() const
 {
-  const suppressions_type& suppressions = context()->suppressions();
-  for (suppressions_type::const_iterator i = suppressions.begin();
-       i != suppressions.end();
-       ++i)
-    {
-      if (is_negated_suppression(*i)
-	  && !(*i)->suppresses_diff(this))
-	return true;
-    }
+  diff_category verdict = NO_CHANGE_CATEGORY;
+  if (context()->lookup_suppression_verdict(this, verdict))
+    return verdict & HAS_ALLOWED_CHANGE_CATEGORY;
+
+  for (auto& n : context()->negated_suppressions())
+    if (!n->suppresses_diff(this))
+      return true;
   return false;
 }
 
@@ -8716,6 +8972,27 @@ string_diff_ptr_map&
 diff_maps::get_distinct_diff_map()
 {return priv_->distinct_diff_map_;}
 
+/// Remove all the diff nodes and impacted interfaces from the current
+/// instance of @ref diff_maps.
+void
+diff_maps::clear()
+{
+  priv_->type_decl_diff_map_.clear();
+  priv_->enum_diff_map_.clear();
+  priv_->class_diff_map_.clear();
+  priv_->union_diff_map_.clear();
+  priv_->typedef_diff_map_.clear();
+  priv_->subrange_diff_map_.clear();
+  priv_->array_diff_map_.clear();
+  priv_->reference_diff_map_.clear();
+  priv_->function_type_diff_map_.clear();
+  priv_->function_decl_diff_map_.clear();
+  priv_->var_decl_diff_map_.clear();
+  priv_->distinct_diff_map_.clear();
+  priv_->fn_parm_diff_map_.clear();
+  priv_->impacted_artifacts_map_.clear();
+}
+
 /// Insert a new diff node into the current instance of @ref diff_maps.
 ///
 /// @param dif the new diff node to insert into the @ref diff_maps.
@@ -8769,23 +9046,36 @@ diff_maps::insert_diff_node(const diff *dif,
 
   // Update the map that associates this diff node to the set of
   // interfaces it impacts.
+  insert_impacted_interface(dif, impacted_iface);
 
-  if (impacted_iface)
-    {
-      diff_artifact_set_map_type::iterator i =
-	priv_->impacted_artifacts_map_.find(dif);
+  return true;
+}
 
-      if (i == priv_->impacted_artifacts_map_.end())
-	{
-	  artifact_sptr_set_type set;
-	  set.insert(impacted_iface);
-	  priv_->impacted_artifacts_map_[dif] = set;
-	}
-      else
-	i->second.insert(impacted_iface);
-    }
+/// Record that a given diff node impacts a given interface.
+///
+/// @param d the diff node to consider.
+///
+/// @param impacted_iface the interface (global function or variable)
+/// impacted by @p d.  If this is nil, then this function does
+/// nothing.
+void
+diff_maps::insert_impacted_interface(const diff *d,
+				     const type_or_decl_base_sptr& impacted_iface)
+{
+  if (!impacted_iface)
+    return;
 
-  return true;
+  diff_artifact_set_map_type::iterator i =
+    priv_->impacted_artifacts_map_.find(d);
+
+  if (i == priv_->impacted_artifacts_map_.end())
+    {
+      artifact_sptr_set_type set;
+      set.insert(impacted_iface);
+      priv_->impacted_artifacts_map_[d] = set;
+    }
+  else
+    i->second.insert(impacted_iface);
 }
 
 /// Lookup the interfaces that are impacted by a given leaf diff node.
@@ -10545,11 +10835,20 @@ corpus_diff::priv::apply_supprs_to_added_removed_fns_vars_unreachable_types()
 {
   diff_context_sptr ctxt = get_context();
 
+  // The suppression specifications are evaluated below without the
+  // diff context, so that they don't test the names and sonames of
+  // the binaries being compared again for each artifact.  That test
+  // is performed only once per suppression specification instead.
+  const diff_context_sptr no_ctxt;
+
   const suppressions_type& suppressions = ctxt->suppressions();
   for (suppressions_type::const_iterator i = suppressions.begin();
        i != suppressions.end();
        ++i)
     {
+      if (!suppression_can_match(*ctxt, **i))
+	continue;
+
       // Added/Deleted functions.
       if (function_suppression_sptr fn_suppr = is_function_suppression(*i))
 	{
@@ -10559,7 +10858,7 @@ corpus_diff::priv::apply_supprs_to_added_removed_fns_vars_unreachable_types()
 	       ++e)
 	    if (function_is_suppressed(e->second, fn_suppr,
 				       function_suppression::ADDED_FUNCTION_CHANGE_KIND,
-				       ctxt))
+				       no_ctxt))
 	      suppressed_added_fns_[e->first] = e->second;
 
 	  // Deleted functions.
@@ -10568,7 +10867,7 @@ corpus_diff::priv::apply_supprs_to_added_removed_fns_vars_unreachable_types()
 	       ++e)
 	    if (function_is_suppressed(e->second, fn_suppr,
 				       function_suppression::DELETED_FUNCTION_CHANGE_KIND,
-				       ctxt))
+				       no_ctxt))
 	      suppressed_deleted_fns_[e->first] = e->second;
 
 	  // Added function symbols not referenced by any debug info
@@ -10578,7 +10877,7 @@ corpus_diff::priv::apply_supprs_to_added_removed_fns_vars_unreachable_types()
 	       ++e)
 	    if (fn_suppr->suppresses_function_symbol(e->second,
 						     function_suppression::ADDED_FUNCTION_CHANGE_KIND,
-						     ctxt))
+						     no_ctxt))
 	      suppressed_added_unrefed_fn_syms_[e->first] = e->second;
 
 	  // Removed function symbols not referenced by any debug info
@@ -10588,7 +10887,7 @@ corpus_diff::priv::apply_supprs_to_added_removed_fns_vars_unreachable_types()
 	       ++e)
 	    if (fn_suppr->suppresses_function_symbol(e->second,
 						     function_suppression::DELETED_FUNCTION_CHANGE_KIND,
-						     ctxt))
+						     no_ctxt))
 	      suppressed_deleted_unrefed_fn_syms_[e->first] = e->second;
 	}
       // Added/Delete virtual member functions changes that might be
@@ -10607,7 +10906,7 @@ corpus_diff::priv::apply_supprs_to_added_removed_fns_vars_unreachable_types()
 		class_decl_sptr c =
 		  is_class_type(is_method_type(f->get_type())->get_class_type());
 		ABG_ASSERT(c);
-		if (type_suppr->suppresses_type(c, ctxt))
+		if (type_suppr->suppresses_type(c))
 		  suppressed_added_fns_[e->first] = e->second;
 	      }
 	  // Deleted virtual functions
@@ -10621,7 +10920,7 @@ corpus_diff::priv::apply_supprs_to_added_removed_fns_vars_unreachable_types()
 		class_decl_sptr c =
 		  is_class_type(is_method_type(f->get_type())->get_class_type());
 		ABG_ASSERT(c);
-		if (type_suppr->suppresses_type(c, ctxt))
+		if (type_suppr->suppresses_type(c))
 		  suppressed_deleted_fns_[e->first] = e->second;
 	      }
 
@@ -10631,7 +10930,7 @@ corpus_diff::priv::apply_supprs_to_added_removed_fns_vars_unreachable_types()
 		 deleted_unreachable_types_.begin();
 	       e != deleted_unreachable_types_.end();
 	       ++e)
-	    if (type_suppr->suppresses_type(e->second, ctxt))
+	    if (type_suppr->suppresses_type(e->second))
 	      suppressed_deleted_unreachable_types_[e->first] = e->second;
 
 	  // Apply this type suppression to added types
@@ -10640,7 +10939,7 @@ corpus_diff::priv::apply_supprs_to_added_removed_fns_vars_unreachable_types()
 		 added_unreachable_types_.begin();
 	       e != added_unreachable_types_.end();
 	       ++e)
-	    if (type_suppr->suppresses_type(e->second, ctxt))
+	    if (type_suppr->suppresses_type(e->second))
 	      suppressed_added_unreachable_types_[e->first] = e->second;
 	}
       // Added/Deleted variables
@@ -10653,7 +10952,7 @@ corpus_diff::priv::apply_supprs_to_added_removed_fns_vars_unreachable_types()
 	       ++e)
 	    if (variable_is_suppressed(e->second, var_suppr,
 				       variable_suppression::ADDED_VARIABLE_CHANGE_KIND,
-				       ctxt))
+				       no_ctxt))
 	      suppressed_added_vars_[e->first] = e->second;
 
 	  //Deleted variables
@@ -10662,7 +10961,7 @@ corpus_diff::priv::apply_supprs_to_added_removed_fns_vars_unreachable_types()
 	       ++e)
 	    if (variable_is_suppressed(e->second, var_suppr,
 				       variable_suppression::DELETED_VARIABLE_CHANGE_KIND,
-				       ctxt))
+				       no_ctxt))
 	      suppressed_deleted_vars_[e->first] = e->second;
 
 	  // Added variable symbols not referenced by any debug info
@@ -10672,7 +10971,7 @@ corpus_diff::priv::apply_supprs_to_added_removed_fns_vars_unreachable_types()
 	       ++e)
 	    if (var_suppr->suppresses_variable_symbol(e->second,
 						      variable_suppression::ADDED_VARIABLE_CHANGE_KIND,
-						      ctxt))
+						      no_ctxt))
 	      suppressed_added_unrefed_var_syms_[e->first] = e->second;
 
 	  // Removed variable symbols not referenced by any debug info
@@ -10682,7 +10981,7 @@ corpus_diff::priv::apply_supprs_to_added_removed_fns_vars_unreachable_types()
 	       ++e)
 	    if (var_suppr->suppresses_variable_symbol(e->second,
 						      variable_suppression::DELETED_VARIABLE_CHANGE_KIND,
-						      ctxt))
+						      no_ctxt))
 	      suppressed_deleted_unrefed_var_syms_[e->first] = e->second;
 	}
     }
@@ -11069,68 +11368,34 @@ corpus_diff::priv::apply_filters_and_compute_diff_stats(diff_stats& stat)
 	  std::cerr << "in apply_filters_and_compute_diff_stats:"
 		    << "applying filters to "
 		    << changed_fns_.size()
-		    << " changed fns ...\n";
-	  t.start();
-	}
-      // Walk the changed function diff nodes to apply the categorization
-      // filters.
-      diff_sptr diff;
-      for (function_decl_diff_sptrs_type::const_iterator i =
-	     changed_fns_.begin();
-	   i != changed_fns_.end();
-	   ++i)
-	{
-	  diff_sptr diff = *i;
-	  ctxt->maybe_apply_filters(diff);
-	}
-
-      if (get_context()->do_log())
-	{
-	  t.stop();
-	  std::cerr << "in apply_filters_and_compute_diff_stats:"
-		    << "filters to changed fn applied!:" << t << "\n";
-
-	  std::cerr << "in apply_filters_and_compute_diff_stats:"
-		    << "applying filters to "
+		    << " changed fns, "
 		    << sorted_changed_vars_.size()
-		    << " changed vars ...\n";
-	  t.start();
-	}
-
-      // Walk the changed variable diff nodes to apply the categorization
-      // filters.
-      for (var_diff_sptrs_type::const_iterator i = sorted_changed_vars_.begin();
-	   i != sorted_changed_vars_.end();
-	   ++i)
-	{
-	  diff_sptr diff = *i;
-	  ctxt->maybe_apply_filters(diff);
-	}
-
-      if (get_context()->do_log())
-	{
-	  t.stop();
-	  std::cerr << "in apply_filters_and_compute_diff_stats:"
-		    << "filters to changed vars applied!:" << t << "\n";
-
-	  std::cerr << "in apply_filters_and_compute_diff_stats:"
-		    << "applying filters to unreachable types ...\n";
+		    << " changed vars and unreachable types ...\n";
 	  t.start();
 	}
 
-      // walk the changed unreachable types to apply categorization
-      // filters
+      // Walk the changed function, changed variable and changed
+      // unreachable type diff nodes to apply the categorization
+      // filters.  They are all walked in one go so that the diff
+      // nodes they share are categorized only once.
+      diff_ptrs_type diffs;
+      for (auto& diff : changed_fns_)
+	diffs.push_back(diff.get());
+      for (auto& diff : sorted_changed_vars_)
+	diffs.push_back(diff.get());
       for (auto& diff : changed_unreachable_types_sorted())
-	ctxt->maybe_apply_filters(diff);
-
+	diffs.push_back(diff.get());
       for (auto& entry : changed_unreachable_types())
-	ctxt->maybe_apply_filters(entry.second);
+	diffs.push_back(entry.second.get());
+
+      ctxt->maybe_apply_filters(diffs);
 
       if (get_context()->do_log())
 	{
 	  t.stop();
 	  std::cerr << "in apply_filters_and_compute_diff_stats:"
-		    << "filters to unreachable types applied!:" << t << "\n";
+		    << "filters to changed fns, vars and unreachable types "
+		    << "applied!:" << t << "\n";
 
 	  std::cerr << "in apply_filters_and_compute_diff_stats:"
 		    << "categorizing redundant changed sub nodes ...\n";
@@ -12263,6 +12528,30 @@ bool
 corpus_diff::has_net_changes() const
 {return  context()->get_reporter()->diff_has_net_changes(this);}
 
+/// A visitor of @ref diff nodes that clears the categories of the
+/// nodes, and of their canonical nodes, and marks them as not having
+/// been reported.
+struct categorization_clearing_visitor : public diff_node_visitor
+{
+  bool
+  visit(corpus_diff*, bool)
+  {return true;}
+
+  bool
+  visit(diff* d, bool)
+  {
+    d->set_category(NO_CHANGE_CATEGORY);
+    d->set_local_category(NO_CHANGE_CATEGORY);
+    d->reported_once(false);
+    if (diff* canonical = d->get_canonical_diff())
+      {
+	canonical->set_category(NO_CHANGE_CATEGORY);
+	canonical->set_local_category(NO_CHANGE_CATEGORY);
+      }
+    return true;
+  }
+}; // end struct categorization_clearing_visitor
+
 /// Apply the different filters that are registered to be applied to
 /// the diff tree; that includes the categorization filters.  Also,
 /// apply the suppression interpretation filters.
@@ -12302,6 +12591,9 @@ corpus_diff::apply_filters_and_suppressions_before_reporting()
     {
       t.stop();
       std::cerr << "suppressions applied!:" << t << "\n";
+      std::cerr << "suppression verdicts re-used: "
+		<< context()->get_number_of_suppression_verdict_hits()
+		<< "\n";
     }
 
   priv_->diff_stats_.reset(new diff_stats(context()));
@@ -12333,12 +12625,153 @@ corpus_diff::apply_filters_and_suppressions_before_reporting()
   return *priv_->diff_stats_;
 }
 
+/// Forget the result of
+/// corpus_diff::apply_filters_and_suppressions_before_reporting and
+/// perform it again.
+///
+/// This is useful to apply a new set of suppression specifications
+/// to the changes carried by the current instance of @ref
+/// corpus_diff, without computing these changes again.  The
+/// suppression specifications of the diff context must have been
+/// updated beforehand, e.g. by using diff_context::suppressions.
+///
+/// The categories of all the diff nodes of the current instance of
+/// @ref corpus_diff are cleared, as well as the added and removed
+/// artifacts that were suppressed, the leaf diff nodes and the
+/// statistics about the changes.  The categorization filters and the
+/// suppression specifications are then applied again.  The diff
+/// nodes are also marked as not having been reported yet.
+///
+/// @return a reference to the new statistics about the changes
+/// carried by the current instance of @ref corpus_diff.
+const corpus_diff::diff_stats&
+corpus_diff::reapply_filters_and_suppressions()
+{
+  categorization_clearing_visitor v;
+  bool s = context()->visiting_a_node_twice_is_forbidden();
+  context()->forbid_visiting_a_node_twice(false);
+  traverse(v);
+  context()->forbid_visiting_a_node_twice(s);
+  context()->forget_visited_diffs();
+
+  priv_->suppressed_deleted_fns_.clear();
+  priv_->suppressed_added_fns_.clear();
+  priv_->suppressed_deleted_vars_.clear();
+  priv_->suppressed_added_vars_.clear();
+  priv_->suppressed_added_unrefed_fn_syms_.clear();
+  priv_->suppressed_deleted_unrefed_fn_syms_.clear();
+  priv_->suppressed_added_unrefed_var_syms_.clear();
+  priv_->suppressed_deleted_unrefed_var_syms_.clear();
+  priv_->suppressed_deleted_unreachable_types_.clear();
+  priv_->suppressed_added_unreachable_types_.clear();
+  priv_->incompatible_changed_fns_.clear();
+  priv_->incompatible_changed_vars_.clear();
+  priv_->leaf_diffs_.clear();
+  priv_->diff_stats_.reset();
+
+  return apply_filters_and_suppressions_before_reporting();
+}
+
 /// A visitor that marks leaf diff nodes by storing them in the
 /// instance of @ref diff_maps returned by
 /// corpus_diff::get_leaf_diffs() invoked on the current instance of
 /// corpus_diff.
 struct leaf_diff_node_marker_visitor : public diff_node_visitor
 {
+  // If true, this visitor indexes the diff graph it walks, so that
+  // the interfaces impacted by each leaf diff node can be computed
+  // after the walk, by record_impacted_interfaces.
+  bool index_impacted_interfaces_;
+  // The index of the canonical diff nodes met during the walk.
+  unordered_map<const diff*, size_t> node_index_;
+  // For each node index, the indexes of its parent nodes.
+  vector<vector<size_t>> parents_;
+  // For each node index, the interfaces which diff node is that
+  // node.
+  vector<vector<type_or_decl_base_sptr>> interfaces_;
+  // The indexes of the nodes being currently walked.
+  vector<size_t> stack_;
+  // The leaf diff nodes met during the walk.
+  vector<const diff*> leaves_;
+
+  /// Constructor of leaf_diff_node_marker_visitor.
+  ///
+  /// @param index_impacted_interfaces if true, the visitor indexes
+  /// the diff graph it walks to compute the interfaces impacted by
+  /// the leaf diff nodes.
+  leaf_diff_node_marker_visitor(bool index_impacted_interfaces)
+    : index_impacted_interfaces_(index_impacted_interfaces)
+  {}
+
+  /// Get the index of the class of equivalence of a diff node.
+  ///
+  /// @param d the diff node to consider.
+  ///
+  /// @return the index of the canonical diff node of @p d.
+  size_t
+  get_node_index(const diff* d)
+  {
+    const diff* canonical = d->get_canonical_diff();
+    if (!canonical)
+      canonical = d;
+
+    auto i = node_index_.find(canonical);
+    if (i != node_index_.end())
+      return i->second;
+
+    size_t index = parents_.size();
+    node_index_[canonical] = index;
+    parents_.push_back(vector<size_t>());
+    interfaces_.push_back(vector<type_or_decl_base_sptr>());
+    return index;
+  }
+
+  /// Compute the interfaces impacted by each leaf diff node met
+  /// during the walk, and record them in a @ref diff_maps.
+  ///
+  /// The impacted interfaces of a leaf node are found by walking the
+  /// graph of its ancestors once, rather than walking the sub-tree of
+  /// each interface.
+  ///
+  /// @param maps the maps to record the impacted interfaces into.
+  void
+  record_impacted_interfaces(diff_maps& maps)
+  {
+    unordered_map<size_t, artifact_sptr_set_type> impacted_interfaces;
+    vector<size_t> visited(parents_.size(), 0);
+    size_t generation = 0;
+
+    for (auto leaf : leaves_)
+      {
+	size_t index = get_node_index(leaf);
+	auto i = impacted_interfaces.find(index);
+	if (i == impacted_interfaces.end())
+	  {
+	    artifact_sptr_set_type& ifaces = impacted_interfaces[index];
+	    ++generation;
+	    vector<size_t> worklist(1, index);
+	    visited[index] = generation;
+	    while (!worklist.empty())
+	      {
+		size_t n = worklist.back();
+		worklist.pop_back();
+		for (auto& iface : interfaces_[n])
+		  ifaces.insert(iface);
+		for (auto p : parents_[n])
+		  if (visited[p] != generation)
+		    {
+		      visited[p] = generation;
+		      worklist.push_back(p);
+		    }
+	      }
+	    i = impacted_interfaces.find(index);
+	  }
+
+	for (auto& iface : i->second)
+	  maps.insert_impacted_interface(leaf, iface);
+      }
+  }
+
   /// This is called when the visitor visits a diff node.
   ///
   /// It basically tests if the diff node being visited is a leaf diff
@@ -12354,6 +12787,17 @@ struct leaf_diff_node_marker_visitor : public diff_node_visitor
   virtual void
   visit_begin(diff *d)
   {
+    if (index_impacted_interfaces_)
+      if (diff *iface_diff = get_current_topmost_iface_diff())
+	{
+	  size_t index = get_node_index(d);
+	  if (stack_.empty())
+	    interfaces_[index].push_back(iface_diff->first_subject());
+	  else
+	    parents_[index].push_back(stack_.back());
+	  stack_.push_back(index);
+	}
+
     if (d->has_local_changes()
 	// A leaf basic (or class/union) type name change makes no
 	// sense when showing just leaf changes.  It only makes sense
@@ -12404,15 +12848,35 @@ struct leaf_diff_node_marker_visitor : public diff_node_visitor
 
 	if (diff *iface_diff = get_current_topmost_iface_diff())
 	  {
-	    type_or_decl_base_sptr iface = iface_diff->first_subject();
 	    // So, this diff node that is reachable from a global
 	    // function or variable carries a leaf change.  Let's add
 	    // it to the set of of leaf diffs of corpus_diff_node.
+	    //
+	    // When the graph is indexed, the interfaces impacted by
+	    // the leaf are recorded after the walk.
+	    type_or_decl_base_sptr iface;
+	    if (index_impacted_interfaces_)
+	      leaves_.push_back(d);
+	    else
+	      iface = iface_diff->first_subject();
 	    const_cast<corpus_diff*>(corpus_diff_node)->
 	      get_leaf_diffs().insert_diff_node(d, iface);
 	  }
       }
   }
+
+  /// This is called when the visitor is done visiting a diff node.
+  ///
+  /// @param d the diff node being visited.
+  virtual void
+  visit_end(diff *d)
+  {
+    if (index_impacted_interfaces_ && get_current_topmost_iface_diff())
+      {
+	ABG_ASSERT(!stack_.empty() && stack_.back() == get_node_index(d));
+	stack_.pop_back();
+      }
+  }
 }; // end struct leaf_diff_node_marker_visitor
 
 /// Walks the diff nodes associated to the current corpus diff and
@@ -12430,15 +12894,20 @@ corpus_diff::mark_leaf_diff_nodes()
   if (!context()->show_leaf_changes_only())
     return;
 
-  leaf_diff_node_marker_visitor v;
+  // When the impacted interfaces are to be shown, rather than walking
+  // the whole sub-tree of each interface, the graph is walked once
+  // and indexed, and then the interfaces impacted by each leaf node
+  // are found by walking its ancestors.
+  bool show_impacted_interfaces = context()->show_impacted_interfaces();
+  leaf_diff_node_marker_visitor v(show_impacted_interfaces);
   context()->forget_visited_diffs();
   bool s = context()->visiting_a_node_twice_is_forbidden();
   context()->forbid_visiting_a_node_twice(true);
-  if (context()->show_impacted_interfaces())
-    context()->forbid_visiting_a_node_twice_per_interface(true);
   traverse(v);
   context()->forbid_visiting_a_node_twice(s);
-  context()->forbid_visiting_a_node_twice_per_interface(false);
+
+  if (show_impacted_interfaces)
+    v.record_impacted_interfaces(get_leaf_diffs());
 }
 
 /// Get the set of maps that contain leaf nodes.  A leaf node being a
@@ -12565,6 +13034,13 @@ corpus_diff::traverse(diff_node_visitor& v)
 /// Note that the two corpora must have been created in the same @ref
 /// environment, otherwise, this function aborts.
 ///
+/// The functions, variables and ELF symbols of the two corpora are
+/// matched by the ID strings of their symbols and of the aliases of
+/// these, using diff_utils::compute_keyed_diff, as their relative
+/// order doesn't matter.  Only the types that are not
+/// reachable from public interfaces, which are sorted by name, are
+/// compared using the O(ND) algorithm of diff_utils::compute_diff.
+///
 /// @param f the first @ref corpus to consider for the diff.
 ///
 /// @param s the second @ref corpus to consider for the diff.
@@ -12601,21 +13077,22 @@ compute_diff(const corpus_sptr	f,
     f->get_architecture_name() == s->get_architecture_name();
 
   // Compute the diff of publicly defined and exported functions
-  diff_utils::compute_diff<fns_it_type, eq_type>(f->get_functions().begin(),
-						 f->get_functions().end(),
-						 s->get_functions().begin(),
-						 s->get_functions().end(),
-						 r->priv_->fns_edit_script_);
+  diff_utils::compute_keyed_diff<fns_it_type, eq_type,
+				 function_decl_diff_key>
+    (f->get_functions().begin(), f->get_functions().end(),
+     s->get_functions().begin(), s->get_functions().end(),
+     r->priv_->fns_edit_script_);
 
   // Compute the diff of publicly defined and exported variables.
-  diff_utils::compute_diff<vars_it_type, eq_type>
+  diff_utils::compute_keyed_diff<vars_it_type, eq_type, var_decl_diff_key>
     (f->get_variables().begin(), f->get_variables().end(),
      s->get_variables().begin(), s->get_variables().end(),
      r->priv_->vars_edit_script_);
 
   // Compute the diff of function elf symbols not referenced by debug
   // info.
-  diff_utils::compute_diff<symbols_it_type, eq_type>
+  diff_utils::compute_keyed_diff<symbols_it_type, eq_type,
+				 elf_symbol_diff_key>
     (f->get_unreferenced_function_symbols().begin(),
      f->get_unreferenced_function_symbols().end(),
      s->get_unreferenced_function_symbols().begin(),
@@ -12624,7 +13101,8 @@ compute_diff(const corpus_sptr	f,
 
   // Compute the diff of variable elf symbols not referenced by debug
   // info.
-    diff_utils::compute_diff<symbols_it_type, eq_type>
+  diff_utils::compute_keyed_diff<symbols_it_type, eq_type,
+				 elf_symbol_diff_key>
     (f->get_unreferenced_variable_symbols().begin(),
      f->get_unreferenced_variable_symbols().end(),
      s->get_unreferenced_variable_symbols().begin(),
@@ -12994,14 +13472,21 @@ struct category_propagation_visitor : public diff_node_visitor
       {
 	// If we are visiting the class of equivalence of 'd' for the
 	// first time, then let's look at the children of 'd' and
-	// propagate their categories to 'd'.
+	// propagate their categories to 'd'.  A child might however
+	// not have been traversed itself because an equivalent node
+	// was traversed before it, possibly under another sub-tree
+	// walked in the same go (see propagate_categories).  In that
+	// case, let's look at the node that was traversed.
 	//
 	// If the class of equivalence of 'd' has already been
 	// visited, then let's look at the canonical diff nodes of the
 	// children of 'd' and propagate their categories to 'd'.
-	diff* diff = already_visited
-	  ? (*i)->get_canonical_diff()
-	  : *i;
+	diff* diff = *i;
+	if (already_visited)
+	  diff = (*i)->get_canonical_diff();
+	else if (abigail::comparison::diff* traversed =
+		 d->context()->diff_has_been_visited(*i))
+	  diff = traversed;
 
 	ABG_ASSERT(diff);
 
@@ -13133,6 +13618,31 @@ void
 propagate_categories(corpus_diff_sptr diff_tree)
 {propagate_categories(diff_tree.get());}
 
+/// Visit all the nodes of a set of diff sub-trees.  For each node
+/// that has a particular category set, propagate that category set up
+/// to its parent nodes.
+///
+/// The sub-trees are walked in one go, so that a node shared by
+/// several of them is visited only once.
+///
+/// @param diff_trees the diff sub-trees to walk for categorization
+/// purpose.
+void
+propagate_categories(const diff_ptrs_type& diff_trees)
+{
+  if (diff_trees.empty())
+    return;
+
+  diff_context_sptr ctxt = diff_trees.front()->context();
+  category_propagation_visitor v;
+  bool s = ctxt->visiting_a_node_twice_is_forbidden();
+  ctxt->forbid_visiting_a_node_twice(true);
+  ctxt->forget_visited_diffs();
+  for (auto d : diff_trees)
+    d->traverse(v);
+  ctxt->forbid_visiting_a_node_twice(s);
+}
+
 /// A tree node visitor that knows how to categorizes a given diff
 /// node in the SUPPRESSED_CATEGORY category and how to propagate that
 /// categorization.
@@ -855,6 +855,21 @@ struct corpus::priv
   type_maps					type_per_loc_map_;
   mutable vector<type_base_wptr>		types_not_reachable_from_pub_ifaces_;
   unordered_set<interned_string, hash_interned_string> *pub_type_pretty_reprs_;
+  // This associates the canonicalized types that were recorded as
+  // reachable from public interfaces, or whose reachability was
+  // queried, to a dense index into reachable_types_bitset_ below.
+  // The types are keyed by their own node, not by their canonical
+  // type, as the verdict depends on the pretty representation of the
+  // type, which can differ between types that share a canonical type
+  // (e.g, "struct S" and "class S").  Like pub_type_pretty_reprs_,
+  // these are held by the group of the corpus, if any.
+  unordered_map<const type_base*, size_t>	types_reachability_index_;
+  // The reachability verdicts of the types of
+  // types_reachability_index_, as a bitset indexed by
+  // types_reachability_index_.
+  vector<bool>					reachable_types_bitset_;
+  // The number of unset bits in reachable_types_bitset_.
+  size_t					num_unreachable_type_verdicts_;
   bool 					do_log;
 
 private:
@@ -879,6 +894,7 @@ public:
       origin_(ARTIFICIAL_ORIGIN),
       path(p),
       pub_type_pretty_reprs_(),
+      num_unreachable_type_verdicts_(),
       do_log()
   {}
 
@@ -921,6 +937,15 @@ public:
   unordered_set<interned_string, hash_interned_string>*
   get_public_types_pretty_representations();
 
+  priv&
+  get_type_reachability_verdicts_holder();
+
+  void
+  set_type_reachability_verdict(const type_base* t, bool is_reachable);
+
+  void
+  forget_unreachable_type_verdicts();
+
   std::unordered_set<function_decl*>*
   lookup_functions(const interned_string& id);
 
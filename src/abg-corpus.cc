@@ -649,6 +649,77 @@ corpus::priv::get_public_types_pretty_representations()
   return pub_type_pretty_reprs_;
 }
 
+/// Getter of the private data that holds the verdicts of
+/// reachability from public interfaces of the types of the corpus.
+///
+/// As the pretty representations of the types recorded as reachable
+/// are held by the group of the corpus, if any, so are the verdicts.
+///
+/// @return the private data holding the verdicts.
+corpus::priv&
+corpus::priv::get_type_reachability_verdicts_holder()
+{
+  if (group)
+    return *static_cast<corpus*>(group)->priv_;
+  return *this;
+}
+
+/// Record the verdict of reachability from public interfaces of a
+/// canonicalized type.
+///
+/// @param t the canonicalized type to consider.
+///
+/// @param is_reachable true iff @p t is reachable from public
+/// interfaces.
+void
+corpus::priv::set_type_reachability_verdict(const type_base* t,
+					    bool is_reachable)
+{
+  auto i = types_reachability_index_.find(t);
+  if (i == types_reachability_index_.end())
+    {
+      types_reachability_index_.emplace(t, reachable_types_bitset_.size());
+      reachable_types_bitset_.push_back(is_reachable);
+      if (!is_reachable)
+	++num_unreachable_type_verdicts_;
+      return;
+    }
+
+  if (reachable_types_bitset_[i->second] == is_reachable)
+    return;
+
+  reachable_types_bitset_[i->second] = is_reachable;
+  if (is_reachable)
+    --num_unreachable_type_verdicts_;
+  else
+    ++num_unreachable_type_verdicts_;
+}
+
+/// Forget the types that were found to be non-reachable from public
+/// interfaces.
+///
+/// This must be done whenever a new type is recorded as reachable,
+/// as types that were deemed non-reachable might have the same
+/// pretty representation as the new one.
+void
+corpus::priv::forget_unreachable_type_verdicts()
+{
+  if (!num_unreachable_type_verdicts_)
+    return;
+
+  unordered_map<const type_base*, size_t> index;
+  vector<bool> bitset;
+  for (const auto& i : types_reachability_index_)
+    if (reachable_types_bitset_[i.second])
+      {
+	index.emplace(i.first, bitset.size());
+	bitset.push_back(true);
+      }
+  types_reachability_index_.swap(index);
+  reachable_types_bitset_.swap(bitset);
+  num_unreachable_type_verdicts_ = 0;
+}
+
 /// Lookup the function which has a given function ID.
 ///
 /// Note that there can have been several functions with the same ID.
@@ -821,6 +892,11 @@ corpus::record_type_as_reachable_from_public_interfaces(const type_base& t)
   string repr = get_pretty_representation(&t, /*internal=*/false);
   interned_string s = t.get_environment().intern(repr);
   priv_->get_public_types_pretty_representations()->insert(s);
+
+  priv& holder = priv_->get_type_reachability_verdicts_holder();
+  holder.forget_unreachable_type_verdicts();
+  if (t.get_naked_canonical_type())
+    holder.set_type_reachability_verdict(&t, true);
 }
 
 /// Test if a type is reachable from public interfaces (global
@@ -830,17 +906,38 @@ corpus::record_type_as_reachable_from_public_interfaces(const type_base& t)
 /// must have been previously marked as such by calling
 /// corpus::record_type_as_reachable_from_public_interfaces.
 ///
+/// The verdicts of canonicalized types are kept in a bitset indexed
+/// by type, so that the pretty representation of a canonicalized type
+/// is computed at most once.  Note that the verdict of a type is not
+/// shared with the other types of its canonical type, as their pretty
+/// representations can differ.
+///
 /// @param t the type to test for.
 ///
 /// @return true iff @p t is reachable from public interfaces.
 bool
 corpus::type_is_reachable_from_public_interfaces(const type_base& t) const
 {
+  priv& holder = priv_->get_type_reachability_verdicts_holder();
+  bool is_canonicalized = t.get_naked_canonical_type();
+  if (is_canonicalized)
+    {
+      auto i = holder.types_reachability_index_.find(&t);
+      if (i != holder.types_reachability_index_.end())
+	return holder.reachable_types_bitset_[i->second];
+    }
+
   string repr = get_pretty_representation(&t, /*internal=*/false);
   interned_string s = t.get_environment().intern(repr);
 
-  return (priv_->get_public_types_pretty_representations()->find(s)
-	  !=  priv_->get_public_types_pretty_representations()->end());
+  bool is_reachable =
+    (priv_->get_public_types_pretty_representations()->find(s)
+     !=  priv_->get_public_types_pretty_representations()->end());
+
+  if (is_canonicalized)
+    holder.set_type_reachability_verdict(&t, is_reachable);
+
+  return is_reachable;
 }
 
 /// Getter of a sorted vector of the types that are *NOT* reachable
@@ -1763,6 +1860,242 @@ corpus::get_exported_decls_builder() const
   return priv_->exported_decls_builder;
 }
 
+/// An IR visitor that records the approximate amount of memory used
+/// by the IR nodes it visits, per kind of IR node.
+///
+/// The size accounted for each node is the size of the node object
+/// itself plus the size of the storage of the containers it owns that
+/// are reachable through its public interface.  The private data of
+/// the nodes is thus only partially accounted for, so the numbers
+/// must be understood as a lower bound that is meant to tell which
+/// kinds of IR nodes dominate the memory footprint.
+class memory_stats_recorder : public ir_node_visitor
+{
+  memory_stats_type&				stats_;
+  std::unordered_set<const type_or_decl_base*>	recorded_nodes_;
+
+  /// Size of the storage of a vector of pointers.
+  template<typename Vector>
+  static size_t
+  storage_size(const Vector& v)
+  {return v.capacity() * sizeof(typename Vector::value_type);}
+
+  /// Record a node, unless it was recorded already.
+  ///
+  /// @return true iff the node was not recorded already, meaning
+  /// that its sub-nodes are to be visited.
+  bool
+  record(const type_or_decl_base* node, const char* kind, size_t bytes)
+  {
+    if (!recorded_nodes_.insert(node).second)
+      return false;
+    stats_[kind].add(1, bytes);
+    return true;
+  }
+
+public:
+
+  memory_stats_recorder(memory_stats_type& stats)
+    : stats_(stats)
+  {}
+
+  bool
+  visit_begin(scope_decl* d)
+  {
+    return record(d, is_global_scope(d) ? "global_scope" : "scope_decl",
+		  sizeof(*d) + storage_size(d->get_member_decls()));
+  }
+
+  bool
+  visit_begin(namespace_decl* d)
+  {
+    return record(d, "namespace_decl",
+		  sizeof(*d) + storage_size(d->get_member_decls()));
+  }
+
+  bool
+  visit_begin(type_decl* t)
+  {return record(t, "type_decl", sizeof(*t));}
+
+  bool
+  visit_begin(qualified_type_def* t)
+  {return record(t, "qualified_type_def", sizeof(*t));}
+
+  bool
+  visit_begin(pointer_type_def* t)
+  {return record(t, "pointer_type_def", sizeof(*t));}
+
+  bool
+  visit_begin(reference_type_def* t)
+  {return record(t, "reference_type_def", sizeof(*t));}
+
+  bool
+  visit_begin(ptr_to_mbr_type* t)
+  {return record(t, "ptr_to_mbr_type", sizeof(*t));}
+
+  bool
+  visit_begin(array_type_def* t)
+  {
+    return record(t, "array_type_def",
+		  sizeof(*t) + storage_size(t->get_subranges()));
+  }
+
+  bool
+  visit_begin(array_type_def::subrange_type* t)
+  {return record(t, "subrange_type", sizeof(*t));}
+
+  bool
+  visit_begin(enum_type_decl* t)
+  {
+    return record(t, "enum_type_decl",
+		  sizeof(*t) + storage_size(t->get_enumerators()));
+  }
+
+  bool
+  visit_begin(typedef_decl* t)
+  {return record(t, "typedef_decl", sizeof(*t));}
+
+  bool
+  visit_begin(function_type* t)
+  {
+    const function_decl::parameters& parms = t->get_parameters();
+    bool is_method = is_method_type(t);
+    if (!record(t, is_method ? "method_type" : "function_type",
+		(is_method ? sizeof(method_type) : sizeof(function_type))
+		+ storage_size(parms)))
+      return false;
+    for (const auto& p : parms)
+      record(p.get(), "function_decl::parameter", sizeof(*p));
+    return true;
+  }
+
+  bool
+  visit_begin(var_decl* d)
+  {return record(d, "var_decl", sizeof(*d));}
+
+  bool
+  visit_begin(function_decl* d)
+  {
+    bool is_method = is_member_function(d);
+    return record(d, is_method ? "method_decl" : "function_decl",
+		  is_method ? sizeof(method_decl) : sizeof(function_decl));
+  }
+
+  bool
+  visit_begin(function_tdecl* d)
+  {return record(d, "function_tdecl", sizeof(*d));}
+
+  bool
+  visit_begin(class_tdecl* d)
+  {return record(d, "class_tdecl", sizeof(*d));}
+
+  bool
+  visit_begin(class_decl* t)
+  {
+    return record(t, "class_decl",
+		  sizeof(*t)
+		  + storage_size(t->get_member_decls())
+		  + storage_size(t->get_data_members())
+		  + storage_size(t->get_member_functions())
+		  + storage_size(t->get_base_specifiers()));
+  }
+
+  bool
+  visit_begin(union_decl* t)
+  {
+    return record(t, "union_decl",
+		  sizeof(*t)
+		  + storage_size(t->get_member_decls())
+		  + storage_size(t->get_data_members())
+		  + storage_size(t->get_member_functions()));
+  }
+
+  bool
+  visit_begin(class_decl::base_spec* b)
+  {return record(b, "class_decl::base_spec", sizeof(*b));}
+}; // end class memory_stats_recorder
+
+/// Record the approximate amount of memory used by a vector of ELF
+/// symbols.
+///
+/// @param syms the ELF symbols to consider.
+///
+/// @param stats the memory statistics to update.
+static void
+record_elf_symbols_memory_stats(const elf_symbols& syms,
+				memory_stats_type& stats)
+{
+  size_t bytes = syms.capacity() * sizeof(elf_symbol_sptr);
+  for (const auto& sym : syms)
+    bytes += sizeof(*sym) + sym->get_name().capacity();
+  stats["elf_symbol"].add(syms.size(), bytes);
+}
+
+/// Record the approximate amount of memory used by the IR of the
+/// current corpus.
+///
+/// This walks the IR nodes reachable from the translation units of
+/// the corpus and from its type maps and accounts for each of them
+/// once, under the name of its kind (e.g, "class_decl",
+/// "function_type" or "var_decl").  The ELF symbols of the corpus and
+/// the entries of its type maps are accounted for too.
+///
+/// Note that the memory used by the environment of the corpus is not
+/// accounted for here; it is recorded by
+/// environment::record_memory_stats.
+///
+/// @param stats the memory statistics to update.
+void
+corpus::record_memory_stats(memory_stats_type& stats) const
+{
+  memory_stats_recorder recorder(stats);
+
+  for (const auto& tu : get_translation_units())
+    {
+      stats["translation_unit"].add(1, sizeof(*tu));
+      tu->get_global_scope()->traverse(recorder);
+    }
+
+  for (const auto& t : get_types().get_types_sorted_by_name())
+    if (type_base_sptr type = t.lock())
+      type->traverse(recorder);
+
+  const type_maps& maps = get_types();
+  const istring_type_base_wptrs_map_type* all_maps[] =
+    {
+      &maps.basic_types(),
+      &maps.class_types(),
+      &maps.union_types(),
+      &maps.enum_types(),
+      &maps.typedef_types(),
+      &maps.qualified_types(),
+      &maps.pointer_types(),
+      &maps.ptr_to_mbr_types(),
+      &maps.reference_types(),
+      &maps.array_types(),
+      &maps.subrange_types(),
+      &maps.function_types()
+    };
+  size_t nb_entries = 0, bytes = 0;
+  for (const auto m : all_maps)
+    {
+      bytes += get_approximate_hash_container_size(*m);
+      for (const auto& entry : *m)
+	{
+	  nb_entries += entry.second.size();
+	  bytes += entry.second.capacity() * sizeof(type_base_wptr);
+	}
+    }
+  bytes += (maps.get_types_sorted_by_name().capacity()
+	    * sizeof(type_base_wptr));
+  stats["type_maps entries"].add(nb_entries, bytes);
+
+  record_elf_symbols_memory_stats(get_sorted_fun_symbols(), stats);
+  record_elf_symbols_memory_stats(get_sorted_undefined_fun_symbols(), stats);
+  record_elf_symbols_memory_stats(get_sorted_var_symbols(), stats);
+  record_elf_symbols_memory_stats(get_sorted_undefined_var_symbols(), stats);
+}
+
 /// Bitwise | operator for the corpus::origin type.
 ///
 /// @param l the left-hand side operand of the | operation.
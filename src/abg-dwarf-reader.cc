@@ -2258,6 +2258,95 @@ public:
   {
   }
 
+  /// Record the approximate amount of memory used by the hash tables
+  /// of a @ref die_source_dependant_container_set.
+  ///
+  /// @param containers the set of containers to consider.
+  ///
+  /// @param name the name of the side table to record the stats
+  /// under.
+  ///
+  /// @param stats the memory statistics to update.
+  template<typename ContainerType>
+  static void
+  record_side_table_memory_stats
+  (const die_source_dependant_container_set<ContainerType>& containers,
+   const char* name,
+   memory_stats_type& stats)
+  {
+    const die_source sources[] =
+      {
+	PRIMARY_DEBUG_INFO_DIE_SOURCE,
+	ALT_DEBUG_INFO_DIE_SOURCE,
+	TYPE_UNIT_DIE_SOURCE
+      };
+    for (die_source source : sources)
+      record_side_table_memory_stats(containers.get_container(source),
+				     name, stats);
+  }
+
+  /// Record the approximate amount of memory used by a hash table
+  /// of the reader.
+  ///
+  /// @param container the hash table to consider.
+  ///
+  /// @param name the name of the side table to record the stats
+  /// under.
+  ///
+  /// @param stats the memory statistics to update.
+  template<typename ContainerType>
+  static void
+  record_side_table_memory_stats(const ContainerType& container,
+				 const char* name,
+				 memory_stats_type& stats)
+  {
+    string kind = string("DWARF reader: ") + name;
+    stats[kind].add(container.size(),
+		    get_approximate_hash_container_size(container));
+  }
+
+  /// Record the approximate amount of memory used by the side tables
+  /// of the reader.
+  ///
+  /// This is an overload of fe_iface::record_memory_stats.
+  ///
+  /// @param stats the memory statistics to update.
+  void
+  record_memory_stats(memory_stats_type& stats) const
+  {
+    record_side_table_memory_stats(decl_die_repr_die_offsets_maps_,
+				   "decl representation -> DIEs", stats);
+    record_side_table_memory_stats(type_die_repr_die_offsets_maps_,
+				   "type representation -> DIEs", stats);
+    record_side_table_memory_stats(die_qualified_name_maps_,
+				   "DIE -> qualified name", stats);
+    record_side_table_memory_stats(die_pretty_repr_maps_,
+				   "DIE -> pretty representation", stats);
+    record_side_table_memory_stats(die_pretty_type_repr_maps_,
+				   "DIE -> pretty type representation",
+				   stats);
+    record_side_table_memory_stats(decl_die_artefact_maps_,
+				   "decl DIE -> artifact", stats);
+    record_side_table_memory_stats(type_die_artefact_maps_,
+				   "type DIE -> artifact", stats);
+    record_side_table_memory_stats(canonical_type_die_offsets_,
+				   "type DIE -> canonical DIE", stats);
+    record_side_table_memory_stats(canonical_decl_die_offsets_,
+				   "decl DIE -> canonical DIE", stats);
+    record_side_table_memory_stats(die_comparison_results_,
+				   "DIE comparison results", stats);
+    record_side_table_memory_stats(die_tu_map_,
+				   "DIE -> translation unit", stats);
+    record_side_table_memory_stats(primary_die_parent_map_,
+				   "DIE -> parent DIE", stats);
+    record_side_table_memory_stats(alternate_die_parent_map_,
+				   "DIE -> parent DIE", stats);
+    record_side_table_memory_stats(type_section_die_parent_map_,
+				   "DIE -> parent DIE", stats);
+    record_side_table_memory_stats(die_function_with_no_symbol_map_,
+				   "DIE -> function without symbol", stats);
+  }
+
   /// Read and analyze the ELF and DWARF information associated with
   /// the underlying ELF file and build an ABI corpus out of it.
   ///
@@ -16355,12 +16444,12 @@ function_is_suppressed(const reader& rdr,
       || dwarf_tag(function_die) != DW_TAG_subprogram)
     return false;
 
-  string fname = die_string_attribute(function_die, DW_AT_name);
-  string flinkage_name = die_linkage_name(function_die);
-  if (flinkage_name.empty() && die_is_in_c(function_die))
-    flinkage_name = fname;
-  string qualified_name = build_qualified_name(scope, fname);
-
+  // Note that the ELF symbols have been evaluated against the
+  // suppression specifications once, when the symbol table was
+  // loaded.  So the checks below are done before building the names
+  // of the function, which are needed only by the suppression
+  // specifications evaluated at the end.
+  //
   // A non-member non-static function which symbol is not exported is
   // suppressed.
   //
@@ -16392,6 +16481,15 @@ function_is_suppressed(const reader& rdr,
 	    return true;
     }
 
+  if (!rdr.suppressions_index().has_function_suppressions())
+    return false;
+
+  string fname = die_string_attribute(function_die, DW_AT_name);
+  string flinkage_name = die_linkage_name(function_die);
+  if (flinkage_name.empty() && die_is_in_c(function_die))
+    flinkage_name = fname;
+  string qualified_name = build_qualified_name(scope, fname);
+
   return suppr::is_function_suppressed(rdr, qualified_name, flinkage_name,
 				       /*require_drop_property=*/true);
 }
@@ -16540,12 +16638,9 @@ variable_is_suppressed(const reader&		rdr,
 	  && dwarf_tag(variable_die) != DW_TAG_member))
     return false;
 
-  string name = die_string_attribute(variable_die, DW_AT_name);
-  string linkage_name = die_linkage_name(variable_die);
-  if (linkage_name.empty() && die_is_in_c(variable_die))
-    linkage_name = name;
-  string qualified_name = build_qualified_name(scope, name);
-
+  // Like in function_is_suppressed, the checks on the ELF symbol are
+  // done before building the names of the variable.
+  //
   // If a non member variable that is a declaration (has no defined
   // and exported symbol) and is not the specification of another
   // concrete variable, then it's suppressed.  This is a size
@@ -16580,6 +16675,15 @@ variable_is_suppressed(const reader&		rdr,
 	    return true;
     }
 
+  if (!rdr.suppressions_index().has_variable_suppressions())
+    return false;
+
+  string name = die_string_attribute(variable_die, DW_AT_name);
+  string linkage_name = die_linkage_name(variable_die);
+  if (linkage_name.empty() && die_is_in_c(variable_die))
+    linkage_name = name;
+  string qualified_name = build_qualified_name(scope, name);
+
   return suppr::is_variable_suppressed(rdr,
 				       qualified_name,
 				       linkage_name,
@@ -131,6 +131,10 @@ struct reader::priv
   Dwfl_Module*				elf_module		= nullptr;
   // A pointer to the DWARF debug info, if found by locate_dwarf_debug_info.
   Dwarf*				dwarf_handle		= nullptr;
+  // The path to the file holding the DWARF debug info, if found by
+  // locate_dwarf_debug_info.  This is the path to the ELF file itself
+  // if the debug info is not split out.
+  string				dwarf_path;
   // A pointer to the ALT DWARF debug info, which is the debug info
   // that is constructed by the DWZ tool.  It's made of all the type
   // information that was redundant in the DWARF.  DWZ put it there
@@ -180,6 +184,7 @@ struct reader::priv
     dwfl_handle.reset();
     elf_module = nullptr;
     dwarf_handle = nullptr;
+    dwarf_path.clear();
     alt_dwarf_handle = nullptr;
     alt_dwarf_path.clear();
     alt_dwarf_fd = 0;
@@ -297,6 +302,16 @@ struct reader::priv
 
     Dwarf_Addr bias = 0;
     dwarf_handle = dwfl_module_getdwarf(elf_module, &bias);
+    const char *main_file = nullptr, *debug_file = nullptr;
+    dwfl_module_info(elf_module, nullptr, nullptr, nullptr, nullptr,
+		     nullptr, &main_file, &debug_file);
+    if (dwarf_handle)
+      {
+	if (debug_file)
+	  dwarf_path = debug_file;
+	else if (main_file)
+	  dwarf_path = main_file;
+      }
     alt_dwarf_handle = dwarf_getalt(dwarf_handle);
     find_alt_dwarf_debug_info_link(elf_module, alt_dwarf_path);
   }
@@ -482,6 +497,19 @@ const Dwarf*
 reader::dwarf_debug_info() const
 {return priv_->dwarf_handle;}
 
+/// Getter of the path to the file holding the DWARF information of
+/// the current ELF file, on disk.
+///
+/// This is the path to the split DWARF information file, if the
+/// DWARF information was split out of the current ELF file, or the
+/// path to the current ELF file otherwise.
+///
+/// @return the path to the file holding the DWARF information, or
+/// the empty string if no DWARF information was found.
+const string&
+reader::dwarf_debug_info_path() const
+{return priv_->dwarf_path;}
+
 /// Test if the binary has DWARF debug info.
 ///
 /// @return true iff the binary has DWARF debug info.
@@ -29,6 +29,8 @@ struct fe_iface::priv
   std::string dt_soname;
   fe_iface::options_type options;
   suppr::suppressions_type suppressions;
+  mutable suppr::suppressions_index suppressions_index;
+  mutable bool suppressions_indexed = false;
   ir::corpus_sptr corpus;
   ir::corpus_group_sptr corpus_group;
 
@@ -46,6 +48,7 @@ struct fe_iface::priv
     corpus_path.clear();
     dt_soname.clear();
     suppressions.clear();
+    suppressions_indexed = false;
     corpus.reset();
   }
 }; //end struct fe_iface::priv
@@ -142,11 +145,18 @@ fe_iface::load_in_linux_kernel_mode() const
 /// Getter of the vector of suppression specifications associated with
 /// the current front-end.
 ///
+/// As the caller might modify the vector of suppression
+/// specifications returned, this invalidates the index returned by
+/// fe_iface::suppressions_index().
+///
 /// @return the vector of suppression specifications associated with
 /// the current front-end.
 suppr::suppressions_type&
 fe_iface::suppressions()
-{return priv_->suppressions;}
+{
+  priv_->suppressions_indexed = false;
+  return priv_->suppressions;
+}
 
 /// Getter of the vector of suppression specifications associated with
 /// the current front-end.
@@ -164,7 +174,10 @@ fe_iface::suppressions() const
 /// associated with the current front-end.
 void
 fe_iface::suppressions(suppr::suppressions_type& supprs)
-{priv_->suppressions = supprs;}
+{
+  priv_->suppressions = supprs;
+  priv_->suppressions_indexed = false;
+}
 
 /// Add suppressions specifications to the set of suppressions to be
 /// used during the construction of the ABI internal representation
@@ -195,6 +208,26 @@ fe_iface::add_suppressions(const suppr::suppressions_type& supprs)
       suppressions().push_back(s);
 }
 
+/// Getter of the index of the suppression specifications associated
+/// with the current front-end.
+///
+/// The index is built the first time it's needed after the set of
+/// suppression specifications changed.  It's used to quickly get the
+/// suppression specifications that can match a given artifact name.
+///
+/// @return the index of the suppression specifications associated
+/// with the current front-end.
+const suppr::suppressions_index&
+fe_iface::suppressions_index() const
+{
+  if (!priv_->suppressions_indexed)
+    {
+      priv_->suppressions_index.index_suppressions(priv_->suppressions);
+      priv_->suppressions_indexed = true;
+    }
+  return priv_->suppressions_index;
+}
+
 /// Getter for the ABI corpus being built by the current front-end.
 ///
 /// @return the ABI corpus being built by the current front-end.
@@ -349,6 +382,18 @@ fe_iface::add_var_to_exported_or_undefined_decls(const var_decl_sptr& var)
     }
 }
 
+/// Record the approximate amount of memory used by the side tables
+/// of the front-end.
+///
+/// The default implementation doesn't record anything.  Front-ends
+/// that maintain side tables while building the IR ought to override
+/// it.
+///
+/// @param stats the memory statistics to update.
+void
+fe_iface::record_memory_stats(ir::memory_stats_type& /*stats*/) const
+{}
+
 /// The bitwise OR operator for the @ref fe_iface::status type.
 ///
 /// @param l the left-hand side operand.
@@ -11,6 +11,7 @@
 /// the libabigail library.
 
 #include <cassert>
+#include <cstdio>
 #include <cstdlib>
 #include <utility>
 #include <memory>
@@ -192,6 +193,66 @@ trim_white_space(const string& str)
   return str.substr(s, e - s + 1);
 }
 
+/// The classes of characters recognized by the ini file parser.
+///
+/// These are bits of the entries of the table returned by
+/// get_char_class_table().
+enum char_class
+{
+  WHITE_SPACE_CHAR_CLASS = 1,
+  PROPERTY_NAME_CHAR_CLASS = 1 << 1,
+  PROPERTY_VALUE_CHAR_CLASS = 1 << 2,
+  SECTION_NAME_CHAR_CLASS = 1 << 3,
+  FUNCTION_NAME_CHAR_CLASS = 1 << 4,
+  FUNCTION_ARGUMENT_CHAR_CLASS = 1 << 5,
+  /// The class of the characters that are not a new line.
+  LINE_CHAR_CLASS = 1 << 6
+};
+
+/// Get the table that associates each possible value of a character
+/// to the set of classes it belongs to.
+///
+/// The table is built once from the char_is_*() predicates above,
+/// so that scanning a run of characters of a given class costs a
+/// table lookup per character rather than a cascade of comparisons.
+///
+/// @return the table, indexed by the character as an unsigned char.
+/// Each entry is a bitmap of @ref char_class values.
+static const unsigned char*
+get_char_class_table()
+{
+  struct char_class_table
+  {
+    unsigned char classes[256];
+
+    char_class_table()
+    {
+      for (int i = 0; i < 256; ++i)
+	{
+	  unsigned char c = 0;
+	  if (char_is_white_space(i))
+	    c |= WHITE_SPACE_CHAR_CLASS;
+	  if (char_is_property_name_char(i))
+	    c |= PROPERTY_NAME_CHAR_CLASS;
+	  if (char_is_property_value_char(i))
+	    c |= PROPERTY_VALUE_CHAR_CLASS;
+	  if (char_is_section_name_char(i))
+	    c |= SECTION_NAME_CHAR_CLASS;
+	  if (char_is_function_name_char(i))
+	    c |= FUNCTION_NAME_CHAR_CLASS;
+	  if (char_is_function_argument_char(i))
+	    c |= FUNCTION_ARGUMENT_CHAR_CLASS;
+	  if (i != '\n')
+	    c |= LINE_CHAR_CLASS;
+	  classes[i] = c;
+	}
+    }
+  }; // end struct char_class_table
+
+  static const char_class_table table;
+  return table.classes;
+}
+
 // <property stuff>
 
 /// Private data of @ref property type.
@@ -426,6 +487,10 @@ list_property_value::as_string() const
   return priv_->representation_;
 }
 
+/// Destructor of the @ref list_property_value type.
+list_property_value::~list_property_value()
+{}
+
 /// Test if an instance of @property_value is a @ref list_property_value.
 ///
 /// @param v the property_value to consider.
@@ -863,28 +928,125 @@ config::section::~section()
 ///
 /// This is a private type that is used only in the internals of the
 /// ini file parsing.
+///
+/// When parsing a whole ini file, the input is loaded in memory
+/// before being parsed.  This spares the parser a call into the input
+/// stream machinery for each character, and lets it scan runs of
+/// ordinary characters directly from the buffer; see read_char_run().
+///
+/// Otherwise, the input stream is read one character at a time, so
+/// that only the characters that are parsed are consumed from it.
 class read_context
 {
-  /// The input stream we are parsing from.
-  istream& in_;
+  /// The input stream we are parsing from, if it is not loaded in
+  /// memory.
+  istream* in_;
+  /// The content of the input we are parsing, if it is loaded in
+  /// memory.
+  string input_;
+  /// The position of the next character to read from input_.
+  string::size_type pos_;
   /// The current line being parsed.
   unsigned cur_line_;
   /// The current column on the current line.
   unsigned cur_column_;
+  /// Set when an attempt was made to read past the end of input_.
+  bool eof_;
+  /// Set when the input stream was in an erratic state.
+  bool bad_;
   vector<char> buf_;
 
   // Forbid this;
   read_context();
 
+  /// Peek at the next character of the input, without handling
+  /// escaped characters.
+  ///
+  /// Like std::istream::peek(), this reports the end of the input
+  /// when there is no character left to read.
+  ///
+  /// @return the next character of the input, or EOF.
+  char
+  peek_input()
+  {
+    if (in_)
+      return in_->peek();
+    if (!bad_ && pos_ < input_.size())
+      return input_[pos_];
+    if (!bad_)
+      eof_ = true;
+    return EOF;
+  }
+
+  /// Read the next character of the input, without handling escaped
+  /// characters.
+  ///
+  /// Like std::istream::get(), this reports the end of the input
+  /// when there is no character left to read.
+  ///
+  /// @return the character read, or EOF.
+  char
+  get_input()
+  {
+    if (in_)
+      return in_->get();
+    if (!bad_ && pos_ < input_.size())
+      return input_[pos_++];
+    if (!bad_)
+      eof_ = true;
+    return EOF;
+  }
+
 public:
 
   /// The constructor of @ref read_context.
   ///
   /// @param in the input stream to parse from.
-  read_context(istream& in)
-    : in_(in),
+  ///
+  /// @param load_whole_input if true, the whole content of @p in is
+  /// read by this constructor and parsed from memory.  Otherwise, the
+  /// characters are read from @p in as they are parsed.
+  read_context(istream& in, bool load_whole_input)
+    : in_(load_whole_input ? nullptr : &in),
+      pos_(0),
+      cur_line_(0),
+      cur_column_(0),
+      eof_(false),
+      bad_(false)
+  {
+    if (in_)
+      return;
+
+    if (!in.good())
+      {
+	if (in.eof())
+	  eof_ = true;
+	else
+	  bad_ = true;
+	return;
+      }
+
+    char chunk[4096];
+    do
+      {
+	in.read(chunk, sizeof(chunk));
+	input_.append(chunk, in.gcount());
+      }
+    while (in.good());
+    bad_ = in.bad();
+  }
+
+  /// The constructor of @ref read_context.
+  ///
+  /// @param in the string to parse from.
+  read_context(const string& in)
+    : in_(nullptr),
+      input_(in),
+      pos_(0),
       cur_line_(0),
-      cur_column_(0)
+      cur_column_(0),
+      eof_(false),
+      bad_(false)
   {}
 
   /// @return the character that is going to be read by the next
@@ -907,7 +1069,7 @@ public:
       return buf_.back();
 
     escaped = false;
-    char c = in_.peek();
+    char c = peek_input();
     if (handle_escape(c, /*peek=*/true))
       {
 	put_back(c);
@@ -952,7 +1114,7 @@ public:
       }
     else
       {
-	result = in_.get();
+	result = get_input();
 	if (do_handle_escape)
 	  handle_escape(result);
       }
@@ -976,7 +1138,9 @@ public:
   {
     if (!buf_.empty())
       return true;
-    return in_.good();
+    if (in_)
+      return in_->good();
+    return !eof_ && !bad_;
   }
 
   /// Tests if the input stream has reached end of file.
@@ -987,7 +1151,9 @@ public:
   {
     if (!buf_.empty())
       return false;
-    return in_.eof();
+    if (in_)
+      return in_->eof();
+    return eof_;
   }
 
   /// Handles the escaping of a character.
@@ -1099,6 +1265,60 @@ public:
     return true;
   }
 
+  /// Read the run of contiguous characters of a given class that
+  /// starts at the current position of the input.
+  ///
+  /// This is a fast path for the loops that read characters one at a
+  /// time through read_context::peek() and
+  /// read_context::read_next_char().  It stops at the first
+  /// character that is not of the class @p klass, at the first
+  /// backslash, and at the end of the input, leaving these to the
+  /// character-wise loops, which know how to handle escaping and the
+  /// end of the input.
+  ///
+  /// This does nothing when the input is not loaded in memory, as
+  /// the characters of the run would have to be read one at a time
+  /// from the input stream anyway.
+  ///
+  /// @param klass a bitmap of @ref char_class values.  The run is made
+  /// of the characters that belong to at least one of these classes.
+  ///
+  /// @param run if non-nil, the characters of the run are appended to
+  /// this string.  Otherwise, they are dropped on the floor.
+  void
+  read_char_run(unsigned char klass, string* run = 0)
+  {
+    if (in_ || !buf_.empty() || bad_)
+      return;
+
+    const unsigned char* classes = get_char_class_table();
+    const string::size_type size = input_.size(), start = pos_;
+    string::size_type end = start;
+    for (; end < size; ++end)
+      {
+	unsigned char c = input_[end];
+	if (c == '\\' || !(classes[c] & klass))
+	  break;
+	if (c == '\n')
+	  {
+	    ++cur_line_;
+	    cur_column_ = 0;
+	  }
+	else
+	  ++cur_column_;
+      }
+
+    if (end == start)
+      return;
+
+    if (cur_line_ == 0)
+      cur_line_ = 1;
+
+    if (run)
+      run->append(input_, start, end - start);
+    pos_ = end;
+  }
+
   /// Skip (that is, read characters and drop them on the floor) all
   /// the characters up to the next line.
   ///
@@ -1111,11 +1331,12 @@ public:
   skip_line()
   {
     char c = 0;
-    for (bool is_ok = read_next_char(c);
-	 is_ok;
-	 is_ok = read_next_char(c))
-      if (c == '\n')
-	break;
+    for (;;)
+      {
+	read_char_run(LINE_CHAR_CLASS);
+	if (!read_next_char(c) || c == '\n')
+	  break;
+      }
 
     return (c == '\n' || eof());
   }
@@ -1127,11 +1348,14 @@ public:
   bool
   skip_white_spaces()
   {
-    for (char c = peek(); good(); c = peek())
-      if (char_is_white_space(c))
+    for (;;)
+      {
+	read_char_run(WHITE_SPACE_CHAR_CLASS);
+	char c = peek();
+	if (!good() || !char_is_white_space(c))
+	  break;
 	ABG_ASSERT(read_next_char(c));
-      else
-	break;
+      }
     return good() || eof();
   }
 
@@ -1191,9 +1415,11 @@ public:
     ABG_ASSERT(read_next_char(c));
     name += c;
 
-    for (c = peek(); good(); c = peek())
+    for (;;)
       {
-	if (!char_is_property_name_char(c))
+	read_char_run(PROPERTY_NAME_CHAR_CLASS, &name);
+	c = peek();
+	if (!good() || !char_is_property_name_char(c))
 	  break;
 	ABG_ASSERT(read_next_char(c));
 	name += c;
@@ -1220,9 +1446,11 @@ public:
     ABG_ASSERT(read_next_char(c));
     name += c;
 
-    for (c = peek(); good(); c = peek())
+    for (;;)
       {
-	if (!char_is_function_name_char(c))
+	read_char_run(FUNCTION_NAME_CHAR_CLASS, &name);
+	c = peek();
+	if (!good() || !char_is_function_name_char(c))
 	  break;
 	ABG_ASSERT(read_next_char(c));
 	name += c;
@@ -1248,9 +1476,11 @@ public:
     ABG_ASSERT(read_next_char(c));
     argument += c;
 
-    for (c = peek(); good(); c = peek())
+    for (;;)
       {
-	if (!char_is_function_argument_char(c))
+	read_char_run(FUNCTION_ARGUMENT_CHAR_CLASS, &argument);
+	c = peek();
+	if (!good() || !char_is_function_argument_char(c))
 	  break;
 	ABG_ASSERT(read_next_char(c));
 	argument += c;
@@ -1383,8 +1613,12 @@ public:
       return "";
 
     string v;
-    for (b = peek(escaped); good(); b = peek(escaped))
+    for (;;)
       {
+	read_char_run(PROPERTY_VALUE_CHAR_CLASS, &v);
+	b = peek(escaped);
+	if (!good())
+	  break;
 	// If the current character is not suitable to be a in string,
 	// then we reached the end of the string.  Note that espaced
 	// characters are always suitable to be a string.
@@ -1514,9 +1748,11 @@ public:
     ABG_ASSERT(read_next_char(c) || char_is_section_name_char(b));
     name += c;
 
-    for (b = peek(); good(); b = peek())
+    for (;;)
       {
-	if (!char_is_section_name_char(b))
+	read_char_run(SECTION_NAME_CHAR_CLASS, &name);
+	b = peek();
+	if (!good() || !char_is_section_name_char(b))
 	  break;
 	ABG_ASSERT(read_next_char(c));
 	name += c;
@@ -1701,9 +1937,9 @@ bool
 read_sections(std::istream& input,
 	      config::sections_type& sections)
 {
-  read_context ctxt(input);
+  read_context ctxt(input, /*load_whole_input=*/true);
 
-  while (input.good())
+  while (ctxt.good())
     {
       ctxt.skip_white_spaces_or_comments();
       if (config::section_sptr section = ctxt.read_section())
@@ -1712,7 +1948,7 @@ read_sections(std::istream& input,
 	break;
     }
 
-  return input.good() || input.eof();
+  return ctxt.good() || ctxt.eof();
 }
 
 /// Parse the sections of an *.ini file.
@@ -2017,7 +2253,7 @@ bool
 read_function_call_expr(std::istream& input,
 			function_call_expr_sptr& expr)
 {
-  read_context ctxt(input);
+  read_context ctxt(input, /*load_whole_input=*/false);
   return ctxt.read_function_call_expr(expr);
 }
 
@@ -2035,8 +2271,8 @@ bool
 read_function_call_expr(const string& input,
 			function_call_expr_sptr& expr)
 {
-  std::istringstream in(input);
-  return read_function_call_expr(in, expr);
+  read_context ctxt(input);
+  return ctxt.read_function_call_expr(expr);
 }
 
 /// Read a function call expression and build its representation.
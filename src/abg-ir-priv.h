@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <string>
 
 #include "abg-hash.h"
@@ -535,6 +536,23 @@ typedef unordered_set<const function_type*> fn_set_type;
 typedef unordered_map<uint64_t_pair_type, bool,
 		      uint64_t_pair_hash> type_comparison_result_type;
 
+/// A frame of the stack of the comparisons of class, union or
+/// function types that are currently in progress.
+///
+/// It's used to know if the result of a comparison depends on the
+/// (not yet known) result of an enclosing comparison, because a
+/// comparison cycle was detected while comparing sub-types.
+struct type_comparison_frame
+{
+  /// The depth of the comparison in the stack of comparison
+  /// operands.
+  size_t depth;
+  /// The smallest depth of the enclosing comparisons that the
+  /// current comparison depends on.  If this is not smaller than @ref
+  /// depth then the result of the comparison is final.
+  size_t lowest_dependency;
+};
+
 /// The private data of the @ref environment type.
 struct environment::priv
 {
@@ -560,6 +578,18 @@ struct environment::priv
   // either class or function types) that are designated by their
   // memory address in the IR.
   type_comparison_result_type		type_comparison_results_cache_;
+  // This is a cache for the results of comparing two sub-types which
+  // don't depend on any comparison that was still in progress when
+  // they were computed.  Unlike type_comparison_results_cache_, this
+  // one is not cleared at the end of each top-level type comparison
+  // but rather at the end of the whole type canonicalization
+  // process.
+  type_comparison_result_type		final_type_comparison_results_cache_;
+  // The stack of class, union and function type comparisons that are
+  // in progress.
+  vector<type_comparison_frame>		type_comparison_frames_;
+  size_t				type_comparison_cache_hits_;
+  size_t				type_comparison_cache_misses_;
   vector<type_base_sptr>		extra_live_types_;
   interned_string_pool			string_pool_;
   // The two vectors below represent the stack of left and right
@@ -626,6 +656,7 @@ struct environment::priv
   bool					decl_only_class_equals_definition_;
   bool					use_enum_binary_only_equality_;
   bool					allow_type_comparison_results_caching_;
+  bool					keep_final_type_comparison_results_;
   bool					do_log_;
   optional<bool>			analyze_exported_interfaces_only_;
 #ifdef WITH_DEBUG_SELF_COMPARISON
@@ -649,11 +680,14 @@ struct environment::priv
 #endif
 
   priv()
-    : canonicalization_started_(),
+    : type_comparison_cache_hits_(),
+      type_comparison_cache_misses_(),
+      canonicalization_started_(),
       canonicalization_is_done_(),
       decl_only_class_equals_definition_(false),
       use_enum_binary_only_equality_(true),
       allow_type_comparison_results_caching_(false),
+      keep_final_type_comparison_results_(false),
       do_log_(false)
 #ifdef WITH_DEBUG_SELF_COMPARISON
     ,
@@ -687,6 +721,36 @@ struct environment::priv
   allow_type_comparison_results_caching() const
   {return allow_type_comparison_results_caching_;}
 
+  /// Keep the final results of sub-types comparisons across
+  /// top-level type comparisons.
+  ///
+  /// A sub-types comparison result is final if it doesn't depend on
+  /// the result of a comparison that was still in progress when it
+  /// was computed.  Note that this only has an effect when type
+  /// comparison results caching is allowed.
+  ///
+  /// This must only be used while the types being compared don't
+  /// change, e.g, during type canonicalization.
+  ///
+  /// @param f if true, keep the final sub-types comparison results.
+  /// Otherwise, forget about the results kept so far.
+  void
+  keep_final_type_comparison_results(bool f)
+  {
+    keep_final_type_comparison_results_ = f;
+    if (!f)
+      final_type_comparison_results_cache_.clear();
+  }
+
+  /// Test if the final sub-types comparison results are kept across
+  /// top-level type comparisons.
+  ///
+  /// @return true iff the final sub-types comparison results are
+  /// kept across top-level type comparisons.
+  bool
+  keep_final_type_comparison_results() const
+  {return keep_final_type_comparison_results_;}
+
   void
   do_log(bool f)
   {do_log_ = f;}
@@ -712,10 +776,17 @@ struct environment::priv
   {
     if (allow_type_comparison_results_caching())
       {
-	type_comparison_results_cache_.emplace
-	  (std::make_pair(reinterpret_cast<uint64_t>(&first),
-			  reinterpret_cast<uint64_t>(&second)),
-	   r);
+	uint64_t_pair_type key =
+	  std::make_pair(reinterpret_cast<uint64_t>(&first),
+			 reinterpret_cast<uint64_t>(&second));
+	type_comparison_results_cache_.emplace(key, r);
+
+	// Comparison cycles are broken by optimistically considering
+	// the types involved as being equal, so a negative result is
+	// always final.
+	if (keep_final_type_comparison_results()
+	    && (!r || type_comparison_is_final()))
+	  final_type_comparison_results_cache_.emplace(key, r);
       }
   }
 
@@ -745,14 +816,40 @@ struct environment::priv
     if (!allow_type_comparison_results_caching())
       return false;
 
+    uint64_t_pair_type key =
+      std::make_pair(reinterpret_cast<uint64_t>(&first),
+		     reinterpret_cast<uint64_t>(&second));
+
+    if (keep_final_type_comparison_results())
+      {
+	type_comparison_result_type::const_iterator it =
+	  final_type_comparison_results_cache_.find(key);
+	if (it != final_type_comparison_results_cache_.end())
+	  {
+	    ++type_comparison_cache_hits_;
+	    r = it->second;
+	    return true;
+	  }
+      }
+
     type_comparison_result_type::const_iterator it =
-      type_comparison_results_cache_.find
-      (std::make_pair(reinterpret_cast<uint64_t>(&first),
-		      reinterpret_cast<uint64_t>(&second)));
+      type_comparison_results_cache_.find(key);
     if (it == type_comparison_results_cache_.end())
-      return false;
+      {
+	++type_comparison_cache_misses_;
+	return false;
+      }
 
+    ++type_comparison_cache_hits_;
     r = it->second;
+
+    // A positive result that is not final might depend on any of
+    // the comparisons in progress.  So must the current comparison.
+    if (r
+	&& keep_final_type_comparison_results()
+	&& !type_comparison_frames_.empty())
+      type_comparison_frames_.back().lowest_dependency = 0;
+
     return true;
   }
 
@@ -761,6 +858,90 @@ struct environment::priv
   clear_type_comparison_results_cache()
   {type_comparison_results_cache_.clear();}
 
+  /// Push a new frame onto the stack of class, union or function
+  /// type comparisons in progress.
+  ///
+  /// This must be done at the beginning of the comparison of two
+  /// class, union or function types, before the comparison operands
+  /// are marked as being compared.
+  void
+  push_type_comparison_frame()
+  {
+    type_comparison_frame f;
+    f.depth = left_type_comp_operands_.size();
+    f.lowest_dependency = std::numeric_limits<size_t>::max();
+    type_comparison_frames_.push_back(f);
+  }
+
+  /// Pop the frame at the top of the stack of type comparisons in
+  /// progress.
+  ///
+  /// The dependencies of the popped comparison become dependencies
+  /// of the enclosing comparison.
+  void
+  pop_type_comparison_frame()
+  {
+    ABG_ASSERT(!type_comparison_frames_.empty());
+    size_t lowest_dependency = type_comparison_frames_.back().lowest_dependency;
+    type_comparison_frames_.pop_back();
+    if (!type_comparison_frames_.empty())
+      {
+	type_comparison_frame& f = type_comparison_frames_.back();
+	f.lowest_dependency = std::min(f.lowest_dependency, lowest_dependency);
+      }
+  }
+
+  /// Record that a comparison cycle was detected while comparing two
+  /// types.
+  ///
+  /// The comparison at the top of the stack of type comparisons in
+  /// progress then depends on the outermost comparison involving
+  /// either one of the two types.
+  ///
+  /// @param left the left-hand-side operand of the comparison that
+  /// closes the cycle.
+  ///
+  /// @param right the right-hand-side operand of the comparison that
+  /// closes the cycle.
+  void
+  record_type_comparison_cycle(const type_base* left,
+			       const type_base* right)
+  {
+    if (type_comparison_frames_.empty())
+      return;
+
+    size_t depth = 0;
+    for (; depth < left_type_comp_operands_.size(); ++depth)
+      {
+	const type_base *l = left_type_comp_operands_[depth];
+	const type_base *r = right_type_comp_operands_[depth];
+	if (l == left || l == right || r == left || r == right)
+	  break;
+      }
+    // If the operands of the cycle are not found in the stack, then
+    // be conservative and consider that the current comparison
+    // depends on the outermost one.
+    if (depth == left_type_comp_operands_.size())
+      depth = 0;
+
+    type_comparison_frame& f = type_comparison_frames_.back();
+    f.lowest_dependency = std::min(f.lowest_dependency, depth);
+  }
+
+  /// Test if the result of the type comparison at the top of the
+  /// stack of type comparisons in progress is final.
+  ///
+  /// @return true iff the result of the current type comparison
+  /// doesn't depend on the result of any enclosing comparison.
+  bool
+  type_comparison_is_final() const
+  {
+    if (type_comparison_frames_.empty())
+      return false;
+    const type_comparison_frame& f = type_comparison_frames_.back();
+    return f.lowest_dependency >= f.depth;
+  }
+
   /// Push a pair of operands on the stack of operands of the current
   /// type comparison, during type canonicalization.
   ///
@@ -1076,6 +1257,98 @@ struct decl_topo_comp
 bool
 is_ptr_ref_or_qual_type(const type_base *t);
 
+/// The sort key of a type, as used by @ref type_topo_comp.
+///
+/// The key carries the properties of a type that are the most
+/// expensive to compute during a topological sort, like the expanded
+/// location of the type or its pretty representation.  Sorting keys
+/// rather than types lets us compute those properties once per type
+/// rather than once per comparison.
+struct type_topo_sort_key
+{
+  /// The kinds of origin of the corpus of a type, as far as sorting
+  /// is concerned.
+  enum origin_kind
+  {
+    /// The type doesn't belong to any corpus.
+    NO_CORPUS_ORIGIN,
+    /// The type belongs to a corpus read from an abixml file.
+    ABIXML_CORPUS_ORIGIN,
+    /// The type belongs to a corpus of any other origin.
+    OTHER_CORPUS_ORIGIN
+  };
+
+  const type_base*		type;
+  const decl_base*		decl;
+  bool				is_ptr_ref_or_qual;
+  bool				has_location;
+  bool				location_is_artificial;
+  origin_kind			origin;
+  string			path;
+  unsigned			line;
+  unsigned			column;
+  mutable interned_string	cached_pretty_repr;
+
+  /// Constructor of @ref type_topo_sort_key.
+  ///
+  /// @param t the type to build the sort key for.
+  explicit type_topo_sort_key(const type_base* t)
+    : type(t),
+      decl(),
+      is_ptr_ref_or_qual(),
+      has_location(),
+      location_is_artificial(),
+      origin(NO_CORPUS_ORIGIN),
+      line(),
+      column()
+  {
+    if (!type)
+      return;
+
+    decl = is_decl(type);
+    is_ptr_ref_or_qual = is_ptr_ref_or_qual_type(type);
+
+    if (const corpus* c = type->get_corpus())
+      origin = (c->get_origin() == corpus::NATIVE_XML_ORIGIN)
+	? ABIXML_CORPUS_ORIGIN
+	: OTHER_CORPUS_ORIGIN;
+
+    if (decl)
+      {
+	location l = get_artificial_or_natural_location(decl);
+	has_location = l.get_value();
+	location_is_artificial = l.get_is_artificial();
+	// The expanded location is only ever used to sort types that
+	// don't come from a binary, so don't bother computing it for
+	// the other ones.
+	if (has_location && origin != OTHER_CORPUS_ORIGIN)
+	  l.expand(path, line, column);
+      }
+  }
+
+  /// Constructor of @ref type_topo_sort_key.
+  ///
+  /// @param t the type to build the sort key for.
+  explicit type_topo_sort_key(const type_base_sptr& t)
+    : type_topo_sort_key(t.get())
+  {}
+
+  /// Getter of the (non-internal) pretty representation of the type.
+  ///
+  /// The pretty representation is computed the first time it's
+  /// needed and then cached in the key.
+  ///
+  /// @return the pretty representation of the type.
+  const interned_string&
+  pretty_representation() const
+  {
+    if (cached_pretty_repr.empty())
+      cached_pretty_repr =
+	type->get_cached_pretty_representation(/*internal=*/false);
+    return cached_pretty_repr;
+  }
+}; // end struct type_topo_sort_key
+
 /// A functor to sort types somewhat topologically.  That is, types
 /// are sorted in a way that makes the ones that are defined "first"
 /// to come first.
@@ -1107,6 +1380,39 @@ struct type_topo_comp
     return false;
   }
 
+  /// Compare two types using the locations carried by their sort
+  /// keys.
+  ///
+  /// This is the counterpart of the compare_using_locations function
+  /// for sort keys.  Both types must have a location.
+  ///
+  /// @param fk the sort key of the first type to compare.
+  ///
+  /// @param sk the sort key of the second type to compare.
+  ///
+  /// @return true iff the type of @p fk compares less than the type
+  /// of @p sk.
+  bool
+  compare_using_locations(const type_topo_sort_key& fk,
+			  const type_topo_sort_key& sk)
+  {
+    ABG_ASSERT(fk.has_location && sk.has_location);
+    if (fk.location_is_artificial == sk.location_is_artificial)
+      {
+	// The locations of the two artfifacts have the same
+	// artificial-ness so they can be compared.
+	if (fk.path != sk.path)
+	  return fk.path < sk.path;
+	if (fk.line != sk.line)
+	  return fk.line < sk.line;
+	if (fk.column != sk.column)
+	  return fk.column < sk.column;
+      }
+
+    return (get_pretty_representation(fk.decl, /*internal=*/false)
+	    < get_pretty_representation(sk.decl, /*internal=*/false));
+  }
+
   /// The "Less Than" comparison operator of this functor.
   ///
   /// @param f the first type to be considered for the comparison.
@@ -1130,34 +1436,52 @@ struct type_topo_comp
   operator()(const type_base *f,
 	     const type_base *s)
   {
+    if (f == s || !f || !s)
+      return false;
+
+    return operator()(type_topo_sort_key(f), type_topo_sort_key(s));
+  }
+
+  /// The "Less Than" comparison operator of this functor, working on
+  /// the sort keys of the types to compare.
+  ///
+  /// @param fk the sort key of the first type to be considered for
+  /// the comparison.
+  ///
+  /// @param sk the sort key of the second type to be considered for
+  /// the comparison.
+  ///
+  /// @return true iff the type of @p fk is less than the type of @p
+  /// sk.
+  bool
+  operator()(const type_topo_sort_key& fk,
+	     const type_topo_sort_key& sk)
+  {
+    const type_base *f = fk.type, *s = sk.type;
+
     if (f == s || !f || !s)
       return false;
 
     // If both decls come from an abixml file, keep the order they
     // have from that abixml file.
-    if (is_decl(f) && is_decl(s)
-	&& has_artificial_or_natural_location(f)
-	&& has_artificial_or_natural_location(s)
-	&& ((!f->get_corpus() && !s->get_corpus())
-	    || (f->get_corpus()
-		&& f->get_corpus()->get_origin() == corpus::NATIVE_XML_ORIGIN
-		&& s->get_corpus()
-		&& (s->get_corpus()->get_origin()
-		    == corpus::NATIVE_XML_ORIGIN))))
-      return compare_using_locations(is_decl(f), is_decl(s));
+    if (fk.has_location
+	&& sk.has_location
+	&& fk.origin == sk.origin
+	&& fk.origin != type_topo_sort_key::OTHER_CORPUS_ORIGIN)
+      return compare_using_locations(fk, sk);
 
-    bool f_is_ptr_ref_or_qual = is_ptr_ref_or_qual_type(f);
-    bool s_is_ptr_ref_or_qual = is_ptr_ref_or_qual_type(s);
+    bool f_is_ptr_ref_or_qual = fk.is_ptr_ref_or_qual;
+    bool s_is_ptr_ref_or_qual = sk.is_ptr_ref_or_qual;
 
     if (f_is_ptr_ref_or_qual != s_is_ptr_ref_or_qual)
       return !f_is_ptr_ref_or_qual && s_is_ptr_ref_or_qual;
 
     if (f_is_ptr_ref_or_qual && s_is_ptr_ref_or_qual
-	&& !has_artificial_or_natural_location(f)
-	&& !has_artificial_or_natural_location(s))
+	&& !fk.has_location
+	&& !sk.has_location)
       {
-	interned_string s1 = f->get_cached_pretty_representation(/*internal=*/false);
-	interned_string s2 = s->get_cached_pretty_representation(/*internal=*/false);
+	interned_string s1 = fk.pretty_representation();
+	interned_string s2 = sk.pretty_representation();
 	if (s1 == s2)
 	  {
 	    if (qualified_type_def * q = is_qualified_type(f))
@@ -1217,8 +1541,8 @@ struct type_topo_comp
 	  }
       }
 
-    interned_string s1 = f->get_cached_pretty_representation(false);
-    interned_string s2 = s->get_cached_pretty_representation(false);
+    interned_string s1 = fk.pretty_representation();
+    interned_string s2 = sk.pretty_representation();
 
     if (s1 != s2)
       return s1 < s2;
@@ -1254,8 +1578,8 @@ struct type_topo_comp
 	  return m_f->get_is_for_static_method() < m_s->get_is_for_static_method();
       }
 
-    decl_base *fd = is_decl(f);
-    decl_base *sd = is_decl(s);
+    const decl_base *fd = fk.decl;
+    const decl_base *sd = sk.decl;
 
     if (!!fd != !!sd)
       return fd && !sd;
@@ -1291,6 +1615,79 @@ struct type_topo_comp
   }
 }; //end struct type_topo_comp
 
+/// Sort a sequence of types using a functor that compares their sort
+/// keys.
+///
+/// The sort key of each type is computed only once, before the
+/// sorting proper.  The resulting order is the same as the one we'd
+/// get by sorting the types themselves using the types overloads of
+/// @p comp.
+///
+/// @param begin an iterator pointing to the beginning of the sequence
+/// of types to sort.
+///
+/// @param end an iterator pointing to the end of the sequence of
+/// types to sort.
+///
+/// @param comp the functor used to compare two instances of @ref
+/// type_topo_sort_key.
+///
+/// @param stable if true, then the relative order of types that
+/// compare equal is preserved.
+template <typename IteratorType, typename KeyComparatorType>
+void
+sort_types_using_keys(IteratorType begin,
+		      IteratorType end,
+		      KeyComparatorType comp,
+		      bool stable)
+{
+  typedef typename std::iterator_traits<IteratorType>::value_type type_ptr;
+
+  std::vector<type_ptr> types(begin, end);
+  std::vector<type_topo_sort_key> keys;
+  keys.reserve(types.size());
+  for (const auto& t : types)
+    keys.push_back(type_topo_sort_key(t));
+
+  // Sort the indexes of the keys rather than the keys themselves, so
+  // that swapping elements during the sort remains cheap.
+  std::vector<size_t> indexes(keys.size());
+  for (size_t i = 0; i < indexes.size(); ++i)
+    indexes[i] = i;
+
+  auto less_than = [&keys, &comp](size_t f, size_t s)
+  {return comp(keys[f], keys[s]);};
+
+  if (stable)
+    std::stable_sort(indexes.begin(), indexes.end(), less_than);
+  else
+    std::sort(indexes.begin(), indexes.end(), less_than);
+
+  for (size_t i : indexes)
+    *begin++ = std::move(types[i]);
+}
+
+/// Sort a sequence of types somewhat topologically, using @ref
+/// type_topo_comp.
+///
+/// @param begin an iterator pointing to the beginning of the sequence
+/// of types to sort.
+///
+/// @param end an iterator pointing to the end of the sequence of
+/// types to sort.
+///
+/// @param stable if true, then the relative order of types that
+/// compare equal is preserved.
+template <typename IteratorType>
+void
+sort_types_topologically(IteratorType begin,
+			 IteratorType end,
+			 bool stable = true)
+{
+  type_topo_comp comp;
+  sort_types_using_keys(begin, end, comp, stable);
+}
+
 /// Functor used to sort types before hashing them.
 struct sort_for_hash_functor
 {
@@ -1371,6 +1768,38 @@ struct sort_for_hash_functor
     return result;
   }
 
+  /// "Less Than" operator for the sort keys of type IR nodes.
+  ///
+  /// This returns true iff the type of the first operand is less
+  /// than the type of the second one.
+  ///
+  /// IR nodes are first sorted using their rank.  Two IR node of the
+  /// same rank are then sorted using @ref type_topo_comp.
+  ///
+  /// @param f the sort key of the first operand to consider.
+  ///
+  /// @param s the sort key of the second operand to consider.
+  bool
+  operator()(const type_topo_sort_key& f, const type_topo_sort_key& s)
+  {
+    size_t rank_f = rank(f.type->kind()),
+      rank_s = rank(s.type->kind());
+
+    // If rank_f or rank_s is zero, it probably means there is a new
+    // type IR kind that needs proper ranking.
+    ABG_ASSERT(rank_f != 0 && rank_s != 0);
+
+    bool result = false;
+    if (rank_f < rank_s)
+      result = true;
+    else if (rank_f == rank_s)
+      {
+	type_topo_comp comp;
+	result = comp(f, s);
+      }
+    return result;
+  }
+
   /// "Less Than" operator for type IR nodes.
   ///
   /// This returns true iff the first operand is less than the second
@@ -1408,6 +1837,8 @@ struct sort_for_hash_functor
 
 /// Sort types before hashing (and then canonicalizing) them.
 ///
+/// The sort keys of the types are computed once before sorting.
+///
 /// @param begin an iterator pointing to the beginning of the sequence
 /// of types to sort.
 ///
@@ -1419,7 +1850,7 @@ sort_types_for_hash_computing_and_c14n(IteratorType begin,
 				       IteratorType end)
 {
   sort_for_hash_functor comp;
-  return std::stable_sort(begin, end, comp);
+  sort_types_using_keys(begin, end, comp, /*stable=*/true);
 }
 
 void
@@ -1474,6 +1905,13 @@ canonicalize_types(const input_iterator& begin,
 
   env.canonicalization_started(true);
 
+  // The types don't change during canonicalization, so the final
+  // results of sub-types comparisons can be re-used across the
+  // canonicalization of different types.
+  env.priv_->keep_final_type_comparison_results(true);
+  env.priv_->type_comparison_cache_hits_ = 0;
+  env.priv_->type_comparison_cache_misses_ = 0;
+
   int i;
   input_iterator t;
   // First, let's compute the canonical type of this type.
@@ -1492,6 +1930,15 @@ canonicalize_types(const input_iterator& begin,
       canonicalize(deref(t));
     }
 
+  if (do_log && show_stats)
+    std::cerr << "type comparison results cache: "
+	      << std::dec
+	      << env.priv_->type_comparison_cache_hits_ << " hits, "
+	      << env.priv_->type_comparison_cache_misses_ << " misses, "
+	      << env.priv_->final_type_comparison_results_cache_.size()
+	      << " final results kept\n";
+
+  env.priv_->keep_final_type_comparison_results(false);
   env.canonicalization_is_done(true);
 
   if (do_log)
@@ -128,6 +128,36 @@ interned_string_pool::create_string(const std::string& str_value)
   return interned_string(result);
 }
 
+/// Getter of the number of distinct strings held by the pool.
+///
+/// @return the number of distinct strings held by the pool.
+size_t
+interned_string_pool::get_number_of_strings() const
+{return priv_->map.size();}
+
+/// Getter of the approximate number of bytes used by the pool.
+///
+/// This accounts for the nodes of the hash table of the pool, for the
+/// two copies of the characters of each string (the one used as key
+/// and the one pointed to by the interned strings) and for the
+/// strings that are allocated on the heap.
+///
+/// @return the approximate number of bytes used by the pool.
+size_t
+interned_string_pool::get_approximate_size() const
+{
+  size_t result = ir::get_approximate_hash_container_size(priv_->map);
+  for (pool_map_type::const_iterator i = priv_->map.begin();
+       i != priv_->map.end();
+       ++i)
+    {
+      result += i->first.capacity();
+      if (i->second)
+	result += sizeof(string) + i->second->capacity();
+    }
+  return result;
+}
+
 /// Destructor.
 interned_string_pool::~interned_string_pool()
 {
@@ -989,6 +1019,8 @@ bool
 is_comparison_cycle_detected(T& l, T& r)
 {
   bool result = l.priv_->comparison_started(l, r);
+  if (result)
+    l.get_environment().priv_->record_type_comparison_cycle(&l, &r);
   return result ;
 }
 
@@ -1037,6 +1069,31 @@ is_comparison_cycle_detected(const class_decl& l, const class_decl& r)
   while(false)
 
 
+/// A scope guard that pushes a frame onto the stack of type
+/// comparisons in progress and pops it when going out of scope.
+///
+/// It's used by the equals overloads which cache their results, to
+/// know if those results depend on enclosing comparisons that are
+/// still in progress.
+class type_comparison_frame_guard
+{
+  const environment& env_;
+
+  type_comparison_frame_guard();
+
+public:
+
+  /// Constructor of @ref type_comparison_frame_guard.
+  ///
+  /// @param t one of the operands of the comparison.
+  type_comparison_frame_guard(const type_base& t)
+    : env_(t.get_environment())
+  {env_.priv_->push_type_comparison_frame();}
+
+  ~type_comparison_frame_guard()
+  {env_.priv_->pop_type_comparison_frame();}
+}; // end class type_comparison_frame_guard
+
 /// Mark a pair of types as being compared.
 ///
 /// This is helpful to later detect recursive cycles in the comparison
@@ -3451,8 +3508,33 @@ sort_types(const canonical_type_sptr_set_type& types,
   for (auto t: types)
     result.push_back(t);
 
-  type_topo_comp comp;
-  std::stable_sort(result.begin(), result.end(), comp);
+  sort_types_topologically(result.begin(), result.end());
+}
+
+/// Emit a report of memory statistics.
+///
+/// Each line of the report shows a kind of artifact, the number of
+/// its instances and the approximate number of bytes they use.  The
+/// last line shows the totals.
+///
+/// @param stats the memory statistics to emit.
+///
+/// @param o the output stream to emit the report to.
+void
+dump_memory_stats(const memory_stats_type& stats, std::ostream& o)
+{
+  size_t total_count = 0, total_bytes = 0;
+  for (const auto& i : stats)
+    {
+      o << i.first << ": "
+	<< i.second.count << " instances, "
+	<< i.second.bytes << " bytes\n";
+      total_count += i.second.count;
+      total_bytes += i.second.bytes;
+    }
+  o << "total: "
+    << total_count << " instances, "
+    << total_bytes << " bytes\n";
 }
 
 /// Get the unique @ref type_decl that represents a "void" type for
@@ -4021,6 +4103,39 @@ environment::get_canonical_type_from_type_id(const char* type_id) const
 {return priv_->get_canonical_type_from_type_id(type_id);}
 #endif
 
+/// Record the approximate amount of memory used by the data held by
+/// the current environment.
+///
+/// This accounts for the interned strings, the entries of the map of
+/// canonical types and the entries of the type comparison caches.
+///
+/// @param stats the memory statistics to update.
+void
+environment::record_memory_stats(memory_stats_type& stats) const
+{
+  stats["interned strings"].add(priv_->string_pool_.get_number_of_strings(),
+				priv_->string_pool_.get_approximate_size());
+
+  size_t nb_canonical_types = 0, bytes = 0;
+  for (const auto& i : priv_->canonical_types_)
+    {
+      nb_canonical_types += i.second.size();
+      bytes += i.first.capacity()
+	+ i.second.capacity() * sizeof(type_base_sptr);
+    }
+  bytes += get_approximate_hash_container_size(priv_->canonical_types_);
+  bytes += priv_->sorted_canonical_types_.capacity() * sizeof(type_base_sptr);
+  stats["canonical types map entries"].add(nb_canonical_types, bytes);
+
+  stats["type comparison cache entries"].add
+    (priv_->type_comparison_results_cache_.size()
+     + priv_->final_type_comparison_results_cache_.size(),
+     get_approximate_hash_container_size
+     (priv_->type_comparison_results_cache_)
+     + get_approximate_hash_container_size
+     (priv_->final_type_comparison_results_cache_));
+}
+
 // </environment stuff>
 
 // <type_or_decl_base stuff>
@@ -7864,10 +7979,8 @@ scope_decl::get_sorted_canonical_types() const
 	   ++e)
 	priv_->sorted_canonical_types_.push_back(*e);
 
-      type_topo_comp comp;
-      std::stable_sort(priv_->sorted_canonical_types_.begin(),
-		       priv_->sorted_canonical_types_.end(),
-		       comp);
+      sort_types_topologically(priv_->sorted_canonical_types_.begin(),
+			       priv_->sorted_canonical_types_.end());
     }
   return priv_->sorted_canonical_types_;
 }
@@ -8170,10 +8283,8 @@ scope_decl::get_sorted_member_types() const
       for (auto t : canonical_pointer_types)
 	priv_->sorted_member_types_.push_back(t);
 
-      type_topo_comp comp;
-      std::stable_sort(priv_->sorted_member_types_.begin(),
-		       priv_->sorted_member_types_.end(),
-		       comp);
+      sort_types_topologically(priv_->sorted_member_types_.begin(),
+			       priv_->sorted_member_types_.end());
     }
 
   const ir::environment& env = get_environment();
@@ -22156,6 +22267,8 @@ equals(const function_type& l, const function_type& r, change_kind* k)
 {
 #define RETURN(value) CACHE_AND_RETURN_COMPARISON_RESULT(value)
 
+  type_comparison_frame_guard frame_guard(l);
+
   RETURN_TRUE_IF_COMPARISON_CYCLE_DETECTED(l, r);
 
   {
@@ -26101,6 +26214,8 @@ method_matches_at_least_one_in_vector(const method_decl_sptr& method,
 bool
 equals(const class_decl& l, const class_decl& r, change_kind* k)
 {
+  type_comparison_frame_guard frame_guard(l);
+
   {
     // First of all, let's see if these two types haven't already been
     // compared.  If so, and if the result of the comparison has been
@@ -27312,6 +27427,7 @@ union_decl::~union_decl()
 bool
 equals(const union_decl& l, const union_decl& r, change_kind* k)
 {
+  type_comparison_frame_guard frame_guard(l);
 
   RETURN_TRUE_IF_COMPARISON_CYCLE_DETECTED(l, r);
 
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// -*- Mode: C++ -*-
+//
+// Copyright (C) 2025 Red Hat, Inc.
+
+/// @file
+///
+/// The private data and functions of the regex helpers of
+/// abg-regex.h.
+///
+/// Interfaces declared/defined in this file are to be used by parts
+/// of libabigail but *NOT* by clients of libabigail.
+///
+
+#ifndef __ABG_REGEX_PRIV_H__
+#define __ABG_REGEX_PRIV_H__
+
+#include <memory>
+
+#include "abg-regex.h"
+
+namespace abigail
+{
+
+namespace regex
+{
+
+struct literal_matcher;
+
+/// A convenience typedef for a shared pointer of @ref literal_matcher.
+typedef std::shared_ptr<literal_matcher> literal_matcher_sptr;
+
+/// The delete functor for the shared_ptr of regex_t built by
+/// regex::compile().
+///
+/// As the deleter is stored alongside the regex_t it deletes, it
+/// also carries what regex::compile() learned about the regular
+/// expression: if the regular expression is made of literal strings
+/// only, @ref matcher is set and regex::match() uses it rather than
+/// the regular expression engine.
+struct compiled_regex_t_deleter : public regex_t_deleter
+{
+  /// If non-nil, this matches the strings matched by the regular
+  /// expression, without running the regular expression engine.
+  literal_matcher_sptr matcher;
+};// end struct compiled_regex_t_deleter
+
+}// end namespace regex
+
+}// end namespace abigail
+
+#endif //__ABG_REGEX_PRIV_H__
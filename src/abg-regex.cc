@@ -10,8 +10,11 @@
 
 #include "config.h"
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <ostream>
+#include <unordered_set>
 
 #include "abg-internal.h"
 
@@ -24,6 +27,8 @@ ABG_BEGIN_EXPORT_DECLARATIONS
 ABG_END_EXPORT_DECLARATIONS
 // </headers defining libabigail's API>
 
+#include "abg-regex-priv.h"
+
 namespace abigail
 {
 
@@ -53,6 +58,161 @@ sptr_utils::build_sptr<regex_t>()
 namespace regex
 {
 
+static bool
+is_special_char(char c);
+
+static bool
+scan_literal(const std::string& r,
+	     std::string::size_type& i,
+	     std::string::size_type end,
+	     std::string& literal);
+
+static bool
+has_end_anchor(const std::string& r, std::string::size_type begin);
+
+/// A matcher for the regular expressions that are made of literal
+/// strings only.
+///
+/// These are the regular expressions of the form:
+///
+///   [^]literal[$]
+///
+/// or
+///
+///   [^](literal1|literal2|...|literalN)[$]
+///
+/// where the literals are made of non-special characters and escaped
+/// special characters.  These are by far the most common regular
+/// expressions in suppression specifications and in the output of
+/// regex::generate_from_strings().  Matching them amounts to string
+/// comparisons, which is much cheaper than running regexec().
+struct literal_matcher
+{
+  /// True iff the regular expression is anchored at the beginning of
+  /// the string.
+  bool anchored_at_start;
+  /// True iff the regular expression is anchored at the end of the
+  /// string.
+  bool anchored_at_end;
+  /// The literal alternatives of the regular expression.
+  std::vector<std::string> literals;
+  /// If the regular expression is anchored at both ends, this is the
+  /// set of the literal strings it matches.
+  std::unordered_set<std::string> exact_literals;
+
+  literal_matcher()
+    : anchored_at_start(),
+      anchored_at_end()
+  {}
+
+  /// Read a literal string from the string representation of a
+  /// regular expression.
+  ///
+  /// @param r the string representation of the regular expression.
+  ///
+  /// @param i the index of the first character of the literal in @p
+  /// r.  This is updated to the index of the first character that
+  /// follows the literal.
+  ///
+  /// @param end the index of the end of the part of @p r to consider.
+  ///
+  /// @param literal output parameter.  This is set to the literal
+  /// read, with escaped characters un-escaped.
+  ///
+  /// @return true iff a non-empty literal was read and is followed
+  /// by either @p end or a special character.  See scan_literal.
+  static bool
+  read_literal(const std::string& r,
+	       std::string::size_type& i,
+	       std::string::size_type end,
+	       std::string& literal)
+  {return scan_literal(r, i, end, literal) && !literal.empty();}
+
+  /// Analyze the string representation of a regular expression.
+  ///
+  /// @param r the string representation of the regular expression to
+  /// analyze.
+  ///
+  /// @return true iff @p r is made of literals only and can thus be
+  /// matched by this matcher.
+  bool
+  analyze(const std::string& r)
+  {
+    std::string::size_type i = 0, end = r.size();
+
+    if (i < end && r[i] == '^')
+      {
+	anchored_at_start = true;
+	++i;
+      }
+
+    if (has_end_anchor(r, i))
+      {
+	anchored_at_end = true;
+	--end;
+      }
+
+    std::string literal;
+    if (i < end && r[i] == '(')
+      {
+	// Parse "(literal1|literal2|...|literalN)".
+	for (++i;;)
+	  {
+	    if (!read_literal(r, i, end, literal) || i >= end)
+	      return false;
+	    literals.push_back(literal);
+	    if (r[i] == ')' && i + 1 == end)
+	      break;
+	    if (r[i] != '|')
+	      return false;
+	    ++i;
+	  }
+      }
+    else if (!read_literal(r, i, end, literal) || i != end)
+      return false;
+    else
+      literals.push_back(literal);
+
+    if (anchored_at_start && anchored_at_end)
+      exact_literals.insert(literals.begin(), literals.end());
+
+    return true;
+  }
+
+  /// Test if a string is matched by the regular expression.
+  ///
+  /// @param str the string to consider.
+  ///
+  /// @param len the length of @p str.
+  ///
+  /// @return true iff @p str is matched.
+  bool
+  match(const char* str, std::string::size_type len) const
+  {
+    if (anchored_at_start && anchored_at_end)
+      return exact_literals.count(std::string(str, len));
+
+    for (const auto& l : literals)
+      {
+	if (l.size() > len)
+	  continue;
+	if (anchored_at_start)
+	  {
+	    if (!memcmp(str, l.data(), l.size()))
+	      return true;
+	  }
+	else if (anchored_at_end)
+	  {
+	    if (!memcmp(str + len - l.size(), l.data(), l.size()))
+	      return true;
+	  }
+	else if (std::search(str, str + len, l.begin(), l.end()) != str + len)
+	  return true;
+      }
+    return false;
+  }
+}; // end struct literal_matcher
+
 /// Escape regex special charaters in input string.
 ///
 /// @param os the output stream being written to.
@@ -104,13 +264,22 @@ generate_from_strings(const std::vector<std::string>& strs)
 /// The result is held in a shared pointer. This will be null if regex
 /// compilation fails.
 ///
+/// If the regex is made of literal strings only, a @ref
+/// literal_matcher is also built for it, so that regex::match() can
+/// do without the regex engine.
+///
 /// @param str the string representation of the regex.
 ///
 /// @return shared pointer holder of a compiled regex object.
 regex_t_sptr
 compile(const std::string& str)
 {
-  regex_t_sptr r = sptr_utils::build_sptr(new regex_t);
+  compiled_regex_t_deleter deleter;
+  literal_matcher_sptr matcher(new literal_matcher);
+  if (matcher->analyze(str))
+    deleter.matcher = matcher;
+
+  regex_t_sptr r(new regex_t, deleter);
   if (regcomp(r.get(), str.c_str(), REG_EXTENDED))
     r.reset();
   return r;
@@ -126,9 +295,203 @@ compile(const std::string& str)
 bool
 match(const regex_t_sptr& r, const std::string& str)
 {
+  const compiled_regex_t_deleter* deleter =
+    std::get_deleter<compiled_regex_t_deleter>(r);
+  if (deleter && deleter->matcher)
+    {
+      // Like regexec, only consider the characters up to the first
+      // null character.
+      const char* s = str.c_str();
+      return deleter->matcher->match(s, strlen(s));
+    }
   return !regexec(r.get(), str.c_str(), 0, NULL, 0);
 }
 
+/// Test if a character is special in a POSIX extended regular
+/// expression.
+///
+/// @param c the character to consider.
+///
+/// @return true iff @p c is a special character.
+static bool
+is_special_char(char c)
+{
+  static const std::string specials = "^.[]$()|*+?{}\\";
+  return specials.find(c) != std::string::npos;
+}
+
+/// Read the literal characters that start at a given index of the
+/// string representation of a regular expression.
+///
+/// Non-special characters and escaped special characters are
+/// literal characters.  The reading stops at the first special
+/// character, or at the first escape sequence that is not an escaped
+/// special character, as that might be a character class (e.g,
+/// "\w").
+///
+/// @param r the string representation of the regular expression.
+///
+/// @param i the index of the first character to read in @p r.  This
+/// is updated to the index of the first character that was not read.
+///
+/// @param end the index of the end of the part of @p r to consider.
+///
+/// @param literal output parameter.  This is set to the literal
+/// characters read, with escaped characters un-escaped.
+///
+/// @return false iff the reading stopped at an escape sequence that
+/// is not an escaped special character.
+static bool
+scan_literal(const std::string& r,
+	     std::string::size_type& i,
+	     std::string::size_type end,
+	     std::string& literal)
+{
+  literal.clear();
+  while (i < end)
+    {
+      char c = r[i];
+      if (c == '\\')
+	{
+	  if (i + 1 < end && is_special_char(r[i + 1]))
+	    {
+	      literal += r[i + 1];
+	      i += 2;
+	      continue;
+	    }
+	  return false;
+	}
+      if (is_special_char(c))
+	break;
+      literal += c;
+      ++i;
+    }
+  return true;
+}
+
+/// Test if the string representation of a regular expression ends
+/// with an end-of-string anchor, that is, a '$' that is not escaped.
+///
+/// @param r the string representation of the regular expression.
+///
+/// @param begin the index of the beginning of the part of @p r to
+/// consider.
+///
+/// @return true iff @p r ends with a '$' that is not escaped and that
+/// is at @p begin or after.
+static bool
+has_end_anchor(const std::string& r, std::string::size_type begin)
+{
+  std::string::size_type end = r.size();
+  if (end <= begin || r[end - 1] != '$')
+    return false;
+
+  std::string::size_type nb_backslashes = 0;
+  for (std::string::size_type j = end - 1; j > begin && r[j - 1] == '\\'; --j)
+    ++nb_backslashes;
+  return !(nb_backslashes % 2);
+}
+
+/// Get the literal string that starts all the strings matched by a
+/// regular expression.
+///
+/// This analyses the string representation of a POSIX extended
+/// regular expression.  If the regular expression is anchored at the
+/// beginning of the input, then the literal characters that follow
+/// the anchor are a prefix of all the strings the regular expression
+/// can match.  Testing that prefix is thus a cheap way to rule out
+/// strings that cannot match, before running the actual regular
+/// expression engine.
+///
+/// The analysis is conservative: regular expressions with an
+/// alternation anywhere are not analyzed.
+///
+/// @param r the string representation of the regular expression to
+/// consider.
+///
+/// @param prefix output parameter.  This is set to the literal prefix
+/// of the strings matched by @p r.  It's set only if the function
+/// returns true.
+///
+/// @param is_exact output parameter.  This is set to true iff @p r
+/// matches exactly the string @p prefix and nothing else.  It's set
+/// only if the function returns true.
+///
+/// @return true iff a literal prefix (or an exact literal) was found
+/// for @p r.
+bool
+get_literal_prefix(const std::string& r, std::string& prefix, bool& is_exact)
+{
+  if (r.empty() || r[0] != '^' || r.find('|') != std::string::npos)
+    return false;
+
+  std::string literal;
+  std::string::size_type i = 1;
+  scan_literal(r, i, r.size(), literal);
+
+  bool exact = false;
+  if (i < r.size())
+    {
+      char c = r[i];
+      if (c == '$' && i + 1 == r.size())
+	exact = true;
+      else if ((c == '*' || c == '?' || c == '{') && !literal.empty())
+	// The last literal character is optional, so it's not part
+	// of the prefix.
+	literal.erase(literal.size() - 1);
+    }
+
+  if (literal.empty() && !exact)
+    return false;
+
+  prefix = literal;
+  is_exact = exact;
+  return true;
+}
+
+/// Get the literal string that ends all the strings matched by a
+/// regular expression.
+///
+/// This analyses the string representation of a POSIX extended
+/// regular expression.  If the regular expression is anchored at the
+/// end of the input, then the literal characters that precede the
+/// anchor are a suffix of all the strings the regular expression can
+/// match.
+///
+/// The analysis is conservative: regular expressions with an
+/// alternation anywhere are not analyzed.
+///
+/// @param r the string representation of the regular expression to
+/// consider.
+///
+/// @param suffix output parameter.  This is set to the literal suffix
+/// of the strings matched by @p r.  It's set only if the function
+/// returns true.
+///
+/// @return true iff a non-empty literal suffix was found for @p r.
+bool
+get_literal_suffix(const std::string& r, std::string& suffix)
+{
+  if (!has_end_anchor(r, 0) || r.find('|') != std::string::npos)
+    return false;
+
+  std::string::size_type start = r.size() - 1;
+  while (start > 0 && !is_special_char(r[start - 1]))
+    --start;
+
+  // If the scan stopped on a backslash, then the first literal
+  // character we collected is actually escaped and might not be a
+  // literal at all.
+  if (start > 0 && r[start - 1] == '\\')
+    ++start;
+
+  if (start >= r.size() - 1)
+    return false;
+
+  suffix = r.substr(start, r.size() - 1 - start);
+  return true;
+}
+
 }//end namespace regex
 
 }//end namespace abigail
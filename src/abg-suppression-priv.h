@@ -13,6 +13,9 @@
 #ifndef __ABG_SUPPRESSION_PRIV_H__
 #define __ABG_SUPPRESSION_PRIV_H__
 
+#include <mutex>
+#include <unordered_map>
+
 #include "abg-fwd.h"
 #include "abg-regex.h"
 #include "abg-sptr-utils.h"
@@ -256,6 +259,7 @@ struct function_suppression::priv
   mutable regex::regex_t_sptr		symbol_name_regex_;
   string				symbol_name_not_regex_str_;
   mutable regex::regex_t_sptr		symbol_name_not_regex_;
+  unordered_set<string>			symbol_name_not_in_set_;
   string				symbol_version_;
   string				symbol_version_regex_str_;
   mutable regex::regex_t_sptr		symbol_version_regex_;
@@ -426,6 +430,7 @@ struct variable_suppression::priv
   mutable regex::regex_t_sptr		symbol_name_regex_;
   string				symbol_name_not_regex_str_;
   mutable regex::regex_t_sptr		symbol_name_not_regex_;
+  unordered_set<string>			symbol_name_not_in_set_;
   string				symbol_version_;
   string				symbol_version_regex_str_;
   mutable regex::regex_t_sptr		symbol_version_regex_;
@@ -584,6 +589,15 @@ class type_suppression::priv
   unordered_set<string>		source_locations_to_keep_;
   string				source_location_to_keep_regex_str_;
   mutable regex::regex_t_sptr		source_location_to_keep_regex_;
+  // A cache of whether source location paths match
+  // source_location_to_keep_regex_, keyed by source location path.
+  // Each time the regular expression is modified, this data member
+  // should be cleared.
+  mutable std::unordered_map<string, bool> paths_matching_keep_regex_;
+  // The mutex that protects paths_matching_keep_regex_ and the lazy
+  // compilation of source_location_to_keep_regex_, as type
+  // suppressions can be shared by concurrent comparisons.
+  mutable std::mutex			paths_matching_keep_regex_mutex_;
   mutable vector<string>		changed_enumerator_names_;
   mutable vector<regex::regex_t_sptr>	changed_enumerators_regexp_;
   // Whether the "has_strict_flexible_array_data_member_conversion"
@@ -679,6 +693,7 @@ public:
   const regex::regex_t_sptr
   get_source_location_to_keep_regex() const
   {
+    std::lock_guard<std::mutex> lock(paths_matching_keep_regex_mutex_);
     if (!source_location_to_keep_regex_
 	&& !source_location_to_keep_regex_str_.empty())
       source_location_to_keep_regex_ =
@@ -691,7 +706,11 @@ public:
   /// @param r the new regex object.
   void
   set_source_location_to_keep_regex(regex::regex_t_sptr r)
-  {source_location_to_keep_regex_ = r;}
+  {
+    std::lock_guard<std::mutex> lock(paths_matching_keep_regex_mutex_);
+    source_location_to_keep_regex_ = r;
+    paths_matching_keep_regex_.clear();
+  }
 
   /// Getter for the "potential_data_member_names_regex" object.
   ///
@@ -721,6 +740,12 @@ public:
   set_potential_data_member_names_regex(regex::regex_t_sptr &r)
   {potential_data_members_regex_ = r;}
 
+  bool
+  path_matches_source_location_to_keep_regex(const string& path) const;
+
+  bool
+  source_location_path_is_kept(const string& path) const;
+
   friend class type_suppression;
 }; // class type_suppression::priv
 
@@ -10,11 +10,15 @@
 /// This contains the implementation of the suppression engine of
 /// libabigail.
 
+#include <sys/stat.h>
 #include <algorithm>
+#include <ctime>
 
 #include "abg-internal.h"
 #include <memory>
 #include <limits>
+#include <mutex>
+#include <unordered_map>
 
 // <headers defining libabigail's API go under here>
 ABG_BEGIN_EXPORT_DECLARATIONS
@@ -467,8 +471,177 @@ read_suppressions(std::istream& input,
     read_suppressions(*config, suppressions);
 }
 
+/// An entry of the cache of parsed suppression specification files.
+///
+/// The entry records the size and modification time of the file at
+/// the time it was parsed, so that a file that changed on disk since
+/// then is detected as stale and parsed again.
+struct parsed_suppression_file
+{
+  off_t			size;
+  time_t		mtime;
+  ini::config_sptr	config;
+}; // end struct parsed_suppression_file
+
+/// The maximum number of files in the cache of parsed suppression
+/// specification files.
+static const size_t max_parsed_suppression_files = 64;
+
+/// Deep copy a property value of an INI configuration.
+///
+/// @param v the property value to copy.
+///
+/// @return the new copy of @p v.
+static ini::property_value_sptr
+copy_property_value(const ini::property_value_sptr& v)
+{
+  if (ini::string_property_value_sptr s = ini::is_string_property_value(v))
+    return ini::property_value_sptr
+      (new ini::string_property_value(s->as_string()));
+
+  if (ini::list_property_value_sptr l = ini::is_list_property_value(v))
+    return ini::property_value_sptr
+      (new ini::list_property_value(l->get_content()));
+
+  if (ini::tuple_property_value_sptr t = ini::is_tuple_property_value(v))
+    {
+      vector<ini::property_value_sptr> items;
+      for (const auto& i : t->get_value_items())
+	items.push_back(copy_property_value(i));
+      return ini::property_value_sptr(new ini::tuple_property_value(items));
+    }
+
+  ABG_ASSERT_NOT_REACHED;
+  return ini::property_value_sptr();
+}
+
+/// Deep copy a property of an INI configuration.
+///
+/// @param p the property to copy.
+///
+/// @return the new copy of @p p.
+static ini::property_sptr
+copy_property(const ini::property_sptr& p)
+{
+  if (ini::simple_property_sptr s = ini::is_simple_property(p))
+    {
+      if (!s->get_value())
+	return ini::property_sptr(new ini::simple_property(s->get_name()));
+      return ini::property_sptr
+	(new ini::simple_property
+	 (s->get_name(),
+	  ini::is_string_property_value(copy_property_value(s->get_value()))));
+    }
+
+  if (ini::list_property_sptr l = ini::is_list_property(p))
+    return ini::property_sptr
+      (new ini::list_property
+       (l->get_name(),
+	ini::is_list_property_value(copy_property_value(l->get_value()))));
+
+  if (ini::tuple_property_sptr t = ini::is_tuple_property(p))
+    return ini::property_sptr
+      (new ini::tuple_property
+       (t->get_name(),
+	ini::is_tuple_property_value(copy_property_value(t->get_value()))));
+
+  ABG_ASSERT_NOT_REACHED;
+  return ini::property_sptr();
+}
+
+/// Deep copy an INI configuration.
+///
+/// The property values of a configuration lazily build their string
+/// representation, so a configuration can't be shared by threads.
+/// Copying it reads the property values without building these
+/// representations.
+///
+/// @param conf the configuration to copy.
+///
+/// @return the new copy of @p conf.
+static ini::config_sptr
+copy_config(const ini::config& conf)
+{
+  ini::config::sections_type sections;
+  for (const auto& section : conf.get_sections())
+    {
+      ini::config::properties_type properties;
+      for (const auto& p : section->get_properties())
+	properties.push_back(copy_property(p));
+      sections.push_back(ini::config::section_sptr
+			 (new ini::config::section(section->get_name(),
+						   properties)));
+    }
+  return ini::config_sptr(new ini::config(conf.get_path(), sections));
+}
+
+/// Get the parsed form of a suppression specification file.
+///
+/// Tools like abipkgdiff read the same suppression specification
+/// files (e.g, the default system and user ones) once per binary
+/// they compare.  So the result of parsing a given file is cached,
+/// for the lifetime of the current process, and re-used as long as
+/// the size and modification time of the file are unchanged.
+/// Otherwise, the file is parsed again.
+///
+/// Modification times are only known to the second.  So a file
+/// modified during the current second isn't cached, as it could
+/// still be modified without its modification time changing.
+///
+/// The cache holds at most max_parsed_suppression_files files.
+///
+/// Note that the caller gets its own copy of the cached
+/// configuration, as it can't be shared by threads.  The
+/// suppression specifications built from it are fresh instances
+/// each time too, as they carry state (e.g, lazily compiled regular
+/// expressions) that must not be shared between the threads that
+/// might be reading suppressions concurrently.
+///
+/// @param file_path the path to the suppression specification file
+/// to consider.
+///
+/// @return the parsed configuration of the file at @p file_path or
+/// nil if it could not be read.
+static ini::config_sptr
+get_parsed_suppression_file(const string& file_path)
+{
+  static std::mutex cache_mutex;
+  static std::unordered_map<string, parsed_suppression_file> cache;
+
+  struct stat st;
+  if (stat(file_path.c_str(), &st) != 0)
+    return ini::config_sptr();
+
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto i = cache.find(file_path);
+    if (i != cache.end())
+      {
+	if (i->second.size == st.st_size && i->second.mtime == st.st_mtime)
+	  return copy_config(*i->second.config);
+	cache.erase(i);
+      }
+  }
+
+  ini::config_sptr config = ini::read_config(file_path);
+  if (config && st.st_mtime < time(nullptr))
+    {
+      std::lock_guard<std::mutex> lock(cache_mutex);
+      if (cache.size() >= max_parsed_suppression_files)
+	cache.erase(cache.begin());
+      parsed_suppression_file& entry = cache[file_path];
+      entry.size = st.st_size;
+      entry.mtime = st.st_mtime;
+      entry.config = copy_config(*config);
+    }
+  return config;
+}
+
 /// Read suppressions specifications from an input file on disk.
 ///
+/// The parsed form of the file is cached, so reading the same
+/// unchanged file several times only parses it once.
+///
 /// @param input the path to the input file to read from.
 ///
 /// @param suppressions the vector of suppressions to append the newly
@@ -477,7 +650,7 @@ void
 read_suppressions(const string& file_path,
 		  suppressions_type& suppressions)
 {
-  if (ini::config_sptr config = ini::read_config(file_path))
+  if (ini::config_sptr config = get_parsed_suppression_file(file_path))
     read_suppressions(*config, suppressions);
 }
 // </suppression_base stuff>
@@ -764,7 +937,11 @@ type_suppression::get_source_location_to_keep_regex_str() const
 /// @param r the new regular expression.
 void
 type_suppression::set_source_location_to_keep_regex_str(const string& r)
-{priv_->source_location_to_keep_regex_str_ = r;}
+{
+  std::lock_guard<std::mutex> lock(priv_->paths_matching_keep_regex_mutex_);
+  priv_->source_location_to_keep_regex_str_ = r;
+  priv_->paths_matching_keep_regex_.clear();
+}
 
 /// Getter of the vector of the changed enumerators that are supposed
 /// to be suppressed.  Note that this will be "valid" only if the type
@@ -1270,6 +1447,71 @@ suppression_matches_type_name(const suppr::type_suppression&	s,
   return suppression_matches_type_name(s, type_name);
 }
 
+/// Test if a source location path matches the
+/// "source_location_not_regexp" property.
+///
+/// A given source file usually declares many types.  So the result is
+/// cached per path, to avoid matching the same path against the
+/// regular expression again and again.
+///
+/// This function can be called concurrently on a given type
+/// suppression.
+///
+/// @param path the source location path to consider.
+///
+/// @return true iff @p path matches the "source_location_not_regexp"
+/// property.
+bool
+type_suppression::priv::path_matches_source_location_to_keep_regex
+(const string& path) const
+{
+  regex_t_sptr regexp = get_source_location_to_keep_regex();
+  if (!regexp)
+    return false;
+
+  std::lock_guard<std::mutex> lock(paths_matching_keep_regex_mutex_);
+  auto i = paths_matching_keep_regex_.find(path);
+  if (i != paths_matching_keep_regex_.end())
+    return i->second;
+
+  bool does_match = regex::match(regexp, path);
+  // Do not cache the result if the regular expression was changed in
+  // the mean time.
+  if (regexp == source_location_to_keep_regex_)
+    paths_matching_keep_regex_[path] = does_match;
+  return does_match;
+}
+
+/// Test if a source location path designates a file which types
+/// should *NOT* be suppressed.
+///
+/// That is the case if the path matches the
+/// "source_location_not_regexp" property, or if the path or its base
+/// name is in the "source_location_not_in" property.
+///
+/// Only the regular expression matching is cached, so the
+/// "source_location_not_in" property can be modified through
+/// type_suppression::get_source_locations_to_keep at any time.
+///
+/// @param path the source location path to consider.
+///
+/// @return true iff the types declared in the file at @p path should
+/// *NOT* be suppressed.
+bool
+type_suppression::priv::source_location_path_is_kept(const string& path) const
+{
+  if (path_matches_source_location_to_keep_regex(path))
+    return true;
+
+  if (source_locations_to_keep_.empty())
+    return false;
+
+  string path_base;
+  tools_utils::base_name(path, path_base);
+  return (source_locations_to_keep_.count(path_base)
+	  || source_locations_to_keep_.count(path));
+}
+
 /// Test if a type suppression matches a source location.
 ///
 /// @param s the type suppression to consider.
@@ -1284,20 +1526,11 @@ suppression_matches_type_location(const type_suppression&	s,
   if (loc)
     {
       // Check if there is a source location related match.
-      string loc_path, loc_path_base;
+      string loc_path;
       unsigned loc_line = 0, loc_column = 0;
       loc.expand(loc_path, loc_line, loc_column);
 
-      if (regex_t_sptr regexp = s.priv_->get_source_location_to_keep_regex())
-	if (regex::match(regexp, loc_path))
-	  return false;
-
-      tools_utils::base_name(loc_path, loc_path_base);
-      if (s.get_source_locations_to_keep().find(loc_path_base)
-	  != s.get_source_locations_to_keep().end())
-	return false;
-      if (s.get_source_locations_to_keep().find(loc_path)
-	  != s.get_source_locations_to_keep().end())
+      if (s.priv_->source_location_path_is_kept(loc_path))
 	return false;
     }
   else
@@ -2861,6 +3094,43 @@ void
 function_suppression::set_symbol_name_not_regex_str(const string& r)
 {priv_->symbol_name_not_regex_str_ = r;}
 
+/// Getter for a set of names of symbols of functions the user wants
+/// this specification to *NOT* designate.
+///
+/// This is like the regular expression returned by
+/// function_suppression::get_symbol_name_not_regex_str(), but for
+/// an explicit set of names.  Looking up a name in that set is much
+/// cheaper than matching it against a regular expression made of the
+/// alternation of all the names of the set.
+///
+/// If a symbol name is in this set, then the suppression
+/// specification will *NOT* suppress the symbol.
+///
+/// If the symbol name as returned by
+/// function_suppression::get_symbol_name() is not empty, then this
+/// property is ignored at specification evaluation time.
+///
+/// This property might be empty, in which case it's ignored at
+/// evaluation time.
+///
+/// @return the set of names of symbols that are to be *NOT*
+/// suppressed by this suppression specification.
+const unordered_set<string>&
+function_suppression::get_symbol_name_not_in_set() const
+{return priv_->symbol_name_not_in_set_;}
+
+/// Setter for a set of names of symbols of functions the user wants
+/// this specification to *NOT* designate.
+///
+/// If a symbol name is in this set, then the suppression
+/// specification will *NOT* suppress the symbol.
+///
+/// @param s the new set of names of symbols that are to be *NOT*
+/// suppressed by this suppression specification.
+void
+function_suppression::set_symbol_name_not_in_set(const unordered_set<string>& s)
+{priv_->symbol_name_not_in_set_ = s;}
+
 /// Getter for the name of the version of the symbol of the function
 /// the user wants this specification to designate.
 ///
@@ -3152,6 +3422,11 @@ function_suppression::suppresses_function(const function_decl* fn,
 	  && regex::match(symbol_name_not_regex, fn_sym_name))
 	return false;
 
+      const unordered_set<string>& symbol_name_not_in_set =
+	get_symbol_name_not_in_set();
+      if (symbol_name_not_in_set.count(fn_sym_name))
+	return false;
+
       if (get_allow_other_aliases())
 	{
 	  // In this case, we want to allow the suppression of change
@@ -3170,6 +3445,9 @@ function_suppression::suppresses_function(const function_decl* fn,
 		  if (symbol_name_not_regex
 		      && regex::match(symbol_name_not_regex, a->get_name()))
 		    return false;
+
+		  if (symbol_name_not_in_set.count(a->get_name()))
+		    return false;
 		}
 	    }
 	}
@@ -3465,6 +3743,14 @@ suppression_matches_variable_sym_name(const suppr::variable_suppression& s,
     {
       if (regex::match(regexp, var_linkage_name))
 	return false;
+
+      if (s.priv_->symbol_name_not_in_set_.count(var_linkage_name))
+	return false;
+    }
+  else if (!s.priv_->symbol_name_not_in_set_.empty())
+    {
+      if (s.priv_->symbol_name_not_in_set_.count(var_linkage_name))
+	return false;
     }
   else if (s.priv_->symbol_name_.empty())
     return false;
@@ -4046,6 +4332,43 @@ void
 variable_suppression::set_symbol_name_not_regex_str(const string& r)
 {priv_->symbol_name_not_regex_str_ = r;}
 
+/// Getter for a set of names of symbols of variables the user wants
+/// this specification to *NOT* designate.
+///
+/// This is like the regular expression returned by
+/// variable_suppression::get_symbol_name_not_regex_str(), but for
+/// an explicit set of names.  Looking up a name in that set is much
+/// cheaper than matching it against a regular expression made of the
+/// alternation of all the names of the set.
+///
+/// If a symbol name is in this set, then the suppression
+/// specification will *NOT* suppress the symbol.
+///
+/// If the symbol name as returned by
+/// variable_suppression::get_symbol_name() is not empty, then this
+/// property is ignored at specification evaluation time.
+///
+/// This property might be empty, in which case it's ignored at
+/// evaluation time.
+///
+/// @return the set of names of symbols that are to be *NOT*
+/// suppressed by this suppression specification.
+const unordered_set<string>&
+variable_suppression::get_symbol_name_not_in_set() const
+{return priv_->symbol_name_not_in_set_;}
+
+/// Setter for a set of names of symbols of variables the user wants
+/// this specification to *NOT* designate.
+///
+/// If a symbol name is in this set, then the suppression
+/// specification will *NOT* suppress the symbol.
+///
+/// @param s the new set of names of symbols that are to be *NOT*
+/// suppressed by this suppression specification.
+void
+variable_suppression::set_symbol_name_not_in_set(const unordered_set<string>& s)
+{priv_->symbol_name_not_in_set_ = s;}
+
 /// Getter for the version of the symbol of the variable the user
 /// wants the current specification to designate.  This property might
 /// be empty, in which case it's ignored at evaluation time.
@@ -4242,6 +4565,9 @@ variable_suppression::suppresses_variable(const var_decl* var,
 	priv_->get_symbol_name_not_regex();
       if (sym_name_not_regex && regex::match(sym_name_not_regex, var_sym_name))
 	return false;
+
+      if (get_symbol_name_not_in_set().count(var_sym_name))
+	return false;
     }
 
   // Check for symbol_version and symbol_version_regexp property match
@@ -4870,6 +5196,319 @@ file_is_suppressed(const string& file_path,
   return file_suppression_sptr();
 }
 
+// <suppressions_index stuff>
+
+/// An index of names to the positions of the suppression
+/// specifications that can match them.
+///
+/// This is used by @ref suppressions_index to index one kind of name
+/// (e.g, function names or function symbol names) of the suppression
+/// specifications.
+struct suppression_name_index
+{
+  /// The positions of the specifications that match exact names.
+  std::unordered_map<string, vector<size_t>> exact_names;
+  /// The literal prefixes of the specifications that match names by
+  /// a regular expression anchored at the beginning.
+  vector<std::pair<string, size_t>> prefixes;
+  /// The literal suffixes of the specifications that match names by
+  /// a regular expression anchored at the end.
+  vector<std::pair<string, size_t>> suffixes;
+  /// The positions of the specifications that can match any name.
+  vector<size_t> others;
+
+  /// Index a specification that matches an exact name.
+  ///
+  /// @param name the name matched by the specification.
+  ///
+  /// @param i the position of the specification.
+  void
+  add_name(const string& name, size_t i)
+  {exact_names[name].push_back(i);}
+
+  /// Index a specification that matches names by a regular
+  /// expression.
+  ///
+  /// @param r the string representation of the regular expression.
+  ///
+  /// @param i the position of the specification.
+  void
+  add_regex(const string& r, size_t i)
+  {
+    string literal;
+    bool is_exact = false;
+    if (!regex::compile(r))
+      // This regular expression is invalid so we can't reason about
+      // it.  Let the full evaluation of the specification decide.
+      others.push_back(i);
+    else if (regex::get_literal_prefix(r, literal, is_exact))
+      {
+	if (is_exact)
+	  add_name(literal, i);
+	else
+	  prefixes.push_back(std::make_pair(literal, i));
+      }
+    else if (regex::get_literal_suffix(r, literal))
+      suffixes.push_back(std::make_pair(literal, i));
+    else
+      others.push_back(i);
+  }
+
+  /// Index a specification that can match any name.
+  ///
+  /// @param i the position of the specification.
+  void
+  add_any(size_t i)
+  {others.push_back(i);}
+
+  /// Get the positions of the specifications that can match a name.
+  ///
+  /// @param name the name to consider.
+  ///
+  /// @param result output parameter.  The positions of the
+  /// specifications that can match @p name are appended to this.
+  void
+  lookup(const string& name, vector<size_t>& result) const
+  {
+    auto i = exact_names.find(name);
+    if (i != exact_names.end())
+      result.insert(result.end(), i->second.begin(), i->second.end());
+
+    for (const auto& p : prefixes)
+      if (name.size() >= p.first.size()
+	  && name.compare(0, p.first.size(), p.first) == 0)
+	result.push_back(p.second);
+
+    for (const auto& p : suffixes)
+      if (name.size() >= p.first.size()
+	  && name.compare(name.size() - p.first.size(),
+			  p.first.size(), p.first) == 0)
+	result.push_back(p.second);
+
+    result.insert(result.end(), others.begin(), others.end());
+  }
+}; // end struct suppression_name_index
+
+/// The private data of @ref suppressions_index.
+struct suppressions_index::priv
+{
+  suppressions_type			suppressions_;
+  vector<function_suppression_sptr>	fn_supprs_;
+  vector<variable_suppression_sptr>	var_supprs_;
+  vector<type_suppression_sptr>		type_supprs_;
+  suppression_name_index		fn_names_;
+  suppression_name_index		fn_sym_names_;
+  suppression_name_index		var_names_;
+  suppression_name_index		var_sym_names_;
+  suppression_name_index		type_names_;
+
+  /// Sort a vector of positions and remove its duplicates.
+  ///
+  /// @param positions the vector of positions to consider.
+  static void
+  sort_and_unique(vector<size_t>& positions)
+  {
+    std::sort(positions.begin(), positions.end());
+    positions.erase(std::unique(positions.begin(), positions.end()),
+		    positions.end());
+  }
+}; // end struct suppressions_index::priv
+
+/// Default constructor of @ref suppressions_index.
+///
+/// The resulting index is empty.
+suppressions_index::suppressions_index()
+  : priv_(new priv)
+{}
+
+/// Constructor of @ref suppressions_index.
+///
+/// @param supprs the suppression specifications to index.
+suppressions_index::suppressions_index(const suppressions_type& supprs)
+  : priv_(new priv)
+{index_suppressions(supprs);}
+
+suppressions_index::~suppressions_index() = default;
+
+/// Index a set of suppression specifications.
+///
+/// This forgets the previously indexed specifications, if any.
+///
+/// Note that the name properties of the specifications are analyzed
+/// the way the front-ends use them to drop artifacts from the IR,
+/// i.e, the way @ref is_function_suppressed, @ref
+/// is_variable_suppressed and @ref is_type_suppressed do.
+///
+/// @param supprs the suppression specifications to index.
+void
+suppressions_index::index_suppressions(const suppressions_type& supprs)
+{
+  priv_.reset(new priv);
+  priv_->suppressions_ = supprs;
+
+  for (const auto& s : supprs)
+    if (function_suppression_sptr fs = is_function_suppression(s))
+      {
+	size_t i = priv_->fn_supprs_.size();
+	priv_->fn_supprs_.push_back(fs);
+
+	if (!fs->get_name_regex_str().empty())
+	  priv_->fn_names_.add_regex(fs->get_name_regex_str(), i);
+	else if (!fs->get_name_not_regex_str().empty())
+	  priv_->fn_names_.add_any(i);
+	else if (!fs->get_name().empty())
+	  priv_->fn_names_.add_name(fs->get_name(), i);
+
+	if (!fs->get_symbol_name_regex_str().empty())
+	  priv_->fn_sym_names_.add_regex(fs->get_symbol_name_regex_str(), i);
+	else if (!fs->get_symbol_name_not_regex_str().empty()
+		 || !fs->get_symbol_name_not_in_set().empty())
+	  priv_->fn_sym_names_.add_any(i);
+	else if (!fs->get_symbol_name().empty())
+	  priv_->fn_sym_names_.add_name(fs->get_symbol_name(), i);
+      }
+    else if (variable_suppression_sptr vs = is_variable_suppression(s))
+      {
+	size_t i = priv_->var_supprs_.size();
+	priv_->var_supprs_.push_back(vs);
+
+	if (!vs->get_name_regex_str().empty())
+	  priv_->var_names_.add_regex(vs->get_name_regex_str(), i);
+	else if (!vs->get_name_not_regex_str().empty())
+	  priv_->var_names_.add_any(i);
+	else if (!vs->get_name().empty())
+	  priv_->var_names_.add_name(vs->get_name(), i);
+
+	if (!vs->get_symbol_name_regex_str().empty())
+	  priv_->var_sym_names_.add_regex(vs->get_symbol_name_regex_str(), i);
+	else if (!vs->get_symbol_name_not_regex_str().empty()
+		 || !vs->get_symbol_name_not_in_set().empty())
+	  priv_->var_sym_names_.add_any(i);
+	else if (!vs->get_symbol_name().empty())
+	  priv_->var_sym_names_.add_name(vs->get_symbol_name(), i);
+      }
+    else if (type_suppression_sptr ts = is_type_suppression(s))
+      {
+	size_t i = priv_->type_supprs_.size();
+	priv_->type_supprs_.push_back(ts);
+
+	// A type suppression without any name property matches types
+	// of any name.
+	if (!ts->get_type_name().empty())
+	  priv_->type_names_.add_name(ts->get_type_name(), i);
+	else if (!ts->get_type_name_regex_str().empty())
+	  priv_->type_names_.add_regex(ts->get_type_name_regex_str(), i);
+	else
+	  priv_->type_names_.add_any(i);
+      }
+}
+
+/// Getter of the suppression specifications that are indexed.
+///
+/// @return the suppression specifications that are indexed.
+const suppressions_type&
+suppressions_index::get_suppressions() const
+{return priv_->suppressions_;}
+
+/// Test if the indexed suppression specifications comprise function
+/// suppression specifications.
+///
+/// @return true iff at least one function suppression specification
+/// is indexed.
+bool
+suppressions_index::has_function_suppressions() const
+{return !priv_->fn_supprs_.empty();}
+
+/// Test if the indexed suppression specifications comprise variable
+/// suppression specifications.
+///
+/// @return true iff at least one variable suppression specification
+/// is indexed.
+bool
+suppressions_index::has_variable_suppressions() const
+{return !priv_->var_supprs_.empty();}
+
+/// Get the function suppression specifications that can match a
+/// function designated by its name and its linkage name.
+///
+/// @param fn_name the name of the function to consider.  If it's
+/// empty, then it's not considered.
+///
+/// @param fn_linkage_name the linkage name of the function to
+/// consider.  If it's empty, then it's not considered.
+///
+/// @param result output parameter.  This is set to the function
+/// suppression specifications that can match the function.
+void
+suppressions_index::get_function_suppressions
+(const string& fn_name,
+ const string& fn_linkage_name,
+ vector<function_suppression_sptr>& result) const
+{
+  vector<size_t> positions;
+  if (!fn_name.empty())
+    priv_->fn_names_.lookup(fn_name, positions);
+  if (!fn_linkage_name.empty())
+    priv_->fn_sym_names_.lookup(fn_linkage_name, positions);
+  priv::sort_and_unique(positions);
+
+  result.clear();
+  for (size_t i : positions)
+    result.push_back(priv_->fn_supprs_[i]);
+}
+
+/// Get the variable suppression specifications that can match a
+/// variable designated by its name and its linkage name.
+///
+/// @param var_name the name of the variable to consider.  If it's
+/// empty, then it's not considered.
+///
+/// @param var_linkage_name the linkage name of the variable to
+/// consider.  If it's empty, then it's not considered.
+///
+/// @param result output parameter.  This is set to the variable
+/// suppression specifications that can match the variable.
+void
+suppressions_index::get_variable_suppressions
+(const string& var_name,
+ const string& var_linkage_name,
+ vector<variable_suppression_sptr>& result) const
+{
+  vector<size_t> positions;
+  if (!var_name.empty())
+    priv_->var_names_.lookup(var_name, positions);
+  if (!var_linkage_name.empty())
+    priv_->var_sym_names_.lookup(var_linkage_name, positions);
+  priv::sort_and_unique(positions);
+
+  result.clear();
+  for (size_t i : positions)
+    result.push_back(priv_->var_supprs_[i]);
+}
+
+/// Get the type suppression specifications that can match a type
+/// designated by its name.
+///
+/// @param type_name the name of the type to consider.
+///
+/// @param result output parameter.  This is set to the type
+/// suppression specifications that can match the type.
+void
+suppressions_index::get_type_suppressions
+(const string& type_name,
+ vector<type_suppression_sptr>& result) const
+{
+  vector<size_t> positions;
+  priv_->type_names_.lookup(type_name, positions);
+  priv::sort_and_unique(positions);
+
+  result.clear();
+  for (size_t i : positions)
+    result.push_back(priv_->type_supprs_[i]);
+}
+
+// </suppressions_index stuff>
+
 /// Test if a given SONAME is matched by a given suppression
 /// specification.
 ///
@@ -4977,6 +5616,38 @@ suppression_can_match(const fe_iface& fe,
   return true;
 }
 
+/// Test if a suppression specification can match anything in the
+/// binaries being compared in a given diff context.
+///
+/// This is the test that the suppresses_* member functions of the
+/// suppression specifications perform on the names and sonames of
+/// the binaries being compared, each time they are given a diff
+/// context.  Performing it once and then not passing the diff context
+/// anymore avoids doing it for each artifact.
+///
+/// @param ctxt the diff context to consider.  It must have a corpus
+/// diff.
+///
+/// @param s the suppression specification to consider.
+///
+/// @return false iff the suppression specification @p s has some
+/// file name or soname related properties that match none of the
+/// binaries being compared.
+bool
+suppression_can_match(const diff_context& ctxt,
+		      const suppression_base& s)
+{
+  if (!names_of_binaries_match(s, ctxt))
+    if (s.has_file_name_related_property())
+      return false;
+
+  if (!sonames_of_binaries_match(s, ctxt))
+    if (s.has_soname_related_property())
+      return false;
+
+  return true;
+}
+
 /// Test if a given function is suppressed by a suppression
 /// specification.
 ///
@@ -5046,6 +5717,14 @@ suppression_matches_function_sym_name(const fe_iface& fe,
     {
       if (regex::match(regexp, fn_linkage_name))
 	return false;
+
+      if (s.priv_->symbol_name_not_in_set_.count(fn_linkage_name))
+	return false;
+    }
+  else if (!s.priv_->symbol_name_not_in_set_.empty())
+    {
+      if (s.priv_->symbol_name_not_in_set_.count(fn_linkage_name))
+	return false;
     }
   else if (s.priv_->symbol_name_.empty())
     return false;
@@ -5208,19 +5887,22 @@ is_function_suppressed(const fe_iface&	fe,
 		       const string&	fn_linkage_name,
 		       bool		require_drop_property)
 {
-  for (auto i : fe.suppressions())
-    if (suppr::function_suppression_sptr suppr = is_function_suppression(i))
-      {
-	if (require_drop_property && !i->get_drops_artifact_from_ir())
-	  continue;
-	if (!fn_name.empty()
-	    && suppression_matches_function_name(fe, *suppr, fn_name))
-	  return true;
-	if (!fn_linkage_name.empty()
-	    && suppression_matches_function_sym_name(fe, *suppr,
-						     fn_linkage_name))
-	  return true;
-      }
+  vector<function_suppression_sptr> supprs;
+  fe.suppressions_index().get_function_suppressions(fn_name,
+						    fn_linkage_name,
+						    supprs);
+  for (auto& suppr : supprs)
+    {
+      if (require_drop_property && !suppr->get_drops_artifact_from_ir())
+	continue;
+      if (!fn_name.empty()
+	  && suppression_matches_function_name(fe, *suppr, fn_name))
+	return true;
+      if (!fn_linkage_name.empty()
+	  && suppression_matches_function_sym_name(fe, *suppr,
+						   fn_linkage_name))
+	return true;
+    }
   return false;
 }
 
@@ -5248,19 +5930,22 @@ is_variable_suppressed(const fe_iface&	fe,
 		       const string&	var_linkage_name,
 		       bool		require_drop_property)
 {
-  for (auto i : fe.suppressions())
-    if (suppr::variable_suppression_sptr suppr = is_variable_suppression(i))
-      {
-	if (require_drop_property && !i->get_drops_artifact_from_ir())
-	  continue;
-	if (!var_name.empty()
-	    && suppression_matches_variable_name(fe, *suppr, var_name))
-	  return true;
-	if (!var_linkage_name.empty()
-	    && suppression_matches_variable_sym_name(fe, *suppr,
-						     var_linkage_name))
-	  return true;
-      }
+  vector<variable_suppression_sptr> supprs;
+  fe.suppressions_index().get_variable_suppressions(var_name,
+						    var_linkage_name,
+						    supprs);
+  for (auto& suppr : supprs)
+    {
+      if (require_drop_property && !suppr->get_drops_artifact_from_ir())
+	continue;
+      if (!var_name.empty()
+	  && suppression_matches_variable_name(fe, *suppr, var_name))
+	return true;
+      if (!var_linkage_name.empty()
+	  && suppression_matches_variable_sym_name(fe, *suppr,
+						   var_linkage_name))
+	return true;
+    }
   return false;
 }
 
@@ -5292,21 +5977,22 @@ is_type_suppressed(const fe_iface&	fe,
 		   bool&		type_is_opaque,
 		   bool		require_drop_property)
 {
-  for (auto i : fe.suppressions())
-    if (suppr::type_suppression_sptr suppr = is_type_suppression(i))
-      {
-	if (require_drop_property && !i->get_drops_artifact_from_ir())
-	  continue;
-	if (suppression_matches_type_name_or_location(fe, *suppr,
-						      type_name,
-						      type_location))
-	  {
-	    if (is_opaque_type_suppr_spec(*suppr))
-	      type_is_opaque = true;
+  vector<type_suppression_sptr> supprs;
+  fe.suppressions_index().get_type_suppressions(type_name, supprs);
+  for (auto& suppr : supprs)
+    {
+      if (require_drop_property && !suppr->get_drops_artifact_from_ir())
+	continue;
+      if (suppression_matches_type_name_or_location(fe, *suppr,
+						    type_name,
+						    type_location))
+	{
+	  if (is_opaque_type_suppr_spec(*suppr))
+	    type_is_opaque = true;
 
-	    return true;
-	  }
-      }
+	  return true;
+	}
+    }
 
   type_is_opaque = false;
   return false;
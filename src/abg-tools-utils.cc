@@ -2480,35 +2480,30 @@ gen_suppr_spec_from_kernel_abi_whitelists
   suppressions_type result;
   if (!whitelisted_names.empty())
     {
-      // Drop duplicates to simplify the regex we are generating
-      std::sort(whitelisted_names.begin(), whitelisted_names.end());
-      whitelisted_names.erase(std::unique(whitelisted_names.begin(),
-					  whitelisted_names.end()),
-			      whitelisted_names.end());
-
-      // Build a regular expression representing the union of all
-      // the function and variable names expressed in the white list.
-      const std::string regex = regex::generate_from_strings(whitelisted_names);
+      // Build the set of all the function and variable names
+      // expressed in the white list.  Looking a symbol name up in
+      // that set is much cheaper than matching it against a regular
+      // expression made of the alternation of all those names.
+      const unordered_set<string> names(whitelisted_names.begin(),
+					whitelisted_names.end());
 
       // Build a suppression specification which *keeps* functions
-      // whose ELF symbols match the regular expression contained
-      // in function_names_regexp.  This will also keep the ELF
-      // symbols (not designated by any debug info) whose names
-      // match this regexp.
+      // whose ELF symbol names are in the set of white listed
+      // names.  This will also keep the ELF symbols (not designated
+      // by any debug info) whose names are in that set.
       function_suppression_sptr fn_suppr(new function_suppression);
       fn_suppr->set_label("whitelist");
-      fn_suppr->set_symbol_name_not_regex_str(regex);
+      fn_suppr->set_symbol_name_not_in_set(names);
       fn_suppr->set_drops_artifact_from_ir(true);
       result.push_back(fn_suppr);
 
       // Build a suppression specification which *keeps* variables
-      // whose ELF symbols match the regular expression contained
-      // in function_names_regexp.  This will also keep the ELF
-      // symbols (not designated by any debug info) whose names
-      // match this regexp.
+      // whose ELF symbol names are in the set of white listed
+      // names.  This will also keep the ELF symbols (not designated
+      // by any debug info) whose names are in that set.
       variable_suppression_sptr var_suppr(new variable_suppression);
       var_suppr->set_label("whitelist");
-      var_suppr->set_symbol_name_not_regex_str(regex);
+      var_suppr->set_symbol_name_not_in_set(names);
       var_suppr->set_drops_artifact_from_ir(true);
       result.push_back(var_suppr);
     }
@@ -649,8 +649,7 @@ public:
 	 i != types.end();
 	 ++i)
       sorted.push_back(const_cast<type_base*>(*i));
-    type_topo_comp comp;
-    sort(sorted.begin(), sorted.end(), comp);
+    sort_types_topologically(sorted.begin(), sorted.end(), /*stable=*/false);
   }
 
   /// Sort the content of a map of type pointers into a vector.
@@ -670,8 +669,7 @@ public:
 	 i != types.end();
 	 ++i)
       sorted.push_back(type_base_sptr(i->second));
-    type_topo_comp comp;
-    sort(sorted.begin(), sorted.end(), comp);
+    sort_types_topologically(sorted.begin(), sorted.end(), /*stable=*/false);
   }
 
   /// Sort the content of a vector of function types into a vector of
@@ -692,8 +690,7 @@ public:
 	 i != types.end();
 	 ++i)
       sorted.push_back(*i);
-    type_topo_comp comp;
-    sort(sorted.begin(), sorted.end(), comp);
+    sort_types_topologically(sorted.begin(), sorted.end(), /*stable=*/false);
   }
 
   /// Flag a type as having been written out to the XML output.
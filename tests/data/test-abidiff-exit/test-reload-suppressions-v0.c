@@ -0,0 +1,5 @@
+struct S {int m0;};
+struct T {int m0;};
+
+void f(struct S* s) {}
+void g(struct T* t) {}
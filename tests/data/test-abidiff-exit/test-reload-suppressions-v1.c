@@ -0,0 +1,5 @@
+struct S {int m0; char m1;};
+struct T {int m0; char m1;};
+
+void f(struct S* s) {}
+void g(struct T* t) {}
@@ -0,0 +1,19 @@
+/* Compile with:
+   gcc -g -c test48-shared-parm-type-change-v0.c
+
+   The two functions share the type struct S, whose data member is
+   renamed in the second version.  That harmless change must be
+   filtered out for both functions.  */
+
+struct S
+{
+  int m0;
+};
+
+int
+f1(struct S* s)
+{return s->m0;}
+
+int
+f2(const struct S* s)
+{return s->m0;}
@@ -0,0 +1,18 @@
+// Compile this with:
+// g++ -shared -g -o libtest49-leaf-shared-by-ifaces-v0.so test49-leaf-shared-by-ifaces-v0.cc
+
+struct leaf
+{
+  int m0;
+};
+
+// Each of these functions reaches the change of struct leaf through
+// its own diff node.  They are all impacted by that change.
+
+void
+fn1(leaf*)
+{}
+
+void
+fn2(leaf&)
+{}
@@ -0,0 +1,14 @@
+/* Compile with:
+   gcc -Wall -g -shared -Wl,--build-id=0x0123456789abcdef0123456789abcdef01234567 -o libfoo.so foo.c
+   objcopy --only-keep-debug libfoo.so libfoo.so.debug
+   objcopy --strip-debug --add-gnu-debuglink=libfoo.so.debug libfoo.so
+*/
+
+struct S
+{
+  int m0;
+};
+
+int
+f(struct S* s)
+{return 0;}
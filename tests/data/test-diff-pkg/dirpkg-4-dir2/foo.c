@@ -0,0 +1,19 @@
+/* Compile with:
+   gcc -Wall -g -shared -Wl,--build-id=0x0123456789abcdef0123456789abcdef01234567 -o libfoo.so foo.c
+   objcopy --only-keep-debug libfoo.so libfoo.so.debug
+   objcopy --strip-debug --add-gnu-debuglink=libfoo.so.debug libfoo.so
+
+   The stripped libfoo.so is identical to the one of dirpkg-4-dir1,
+   so it is not built from this file.  Only libfoo.so.debug, under
+   dirpkg-4-debug-dir2/usr/lib/debug, is.
+*/
+
+struct S
+{
+  int m0;
+  char m1;
+};
+
+int
+f(struct S* s)
+{return 0;}
@@ -1185,6 +1185,114 @@ InOutSpec in_out_specs[] =
     "data/test-abidiff-exit/test-fam2-report-1.txt",
     "output/test-abidiff-exit/test-fam2-report-1.txt"
   },
+  {
+    "data/test-abidiff-exit/test-net-change-v0.o",
+    "data/test-abidiff-exit/test-net-change-v0.o",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "--no-default-suppression --no-show-locs --quick-check",
+    abigail::tools_utils::ABIDIFF_OK,
+    "data/test-abidiff-exit/test-quick-check-report.txt",
+    "output/test-abidiff-exit/test-quick-check-report-0.txt"
+  },
+  {
+    "data/test-abidiff-exit/test2-filtered-removed-fns-v0.o",
+    "data/test-abidiff-exit/test2-filtered-removed-fns-v1.o",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "--no-default-suppression --no-show-locs --quick-check",
+    abigail::tools_utils::ABIDIFF_ABI_CHANGE
+    | abigail::tools_utils::ABIDIFF_ABI_INCOMPATIBLE_CHANGE,
+    "data/test-abidiff-exit/test-quick-check-report.txt",
+    "output/test-abidiff-exit/test-quick-check-report-1.txt"
+  },
+  {
+    "data/test-abidiff-exit/test2-filtered-removed-fns-v0.o",
+    "data/test-abidiff-exit/test2-filtered-removed-fns-v1.o",
+    "data/test-abidiff-exit/test2-filtered-removed-fns.abignore",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "--no-default-suppression --no-show-locs --quick-check",
+    abigail::tools_utils::ABIDIFF_OK,
+    "data/test-abidiff-exit/test-quick-check-report.txt",
+    "output/test-abidiff-exit/test-quick-check-report-2.txt"
+  },
+  {
+    "data/test-abidiff-exit/test1-voffset-change-v0.o",
+    "data/test-abidiff-exit/test1-voffset-change-v1.o",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "--no-default-suppression --no-show-locs --quick-check",
+    abigail::tools_utils::ABIDIFF_ABI_CHANGE
+    | abigail::tools_utils::ABIDIFF_ABI_INCOMPATIBLE_CHANGE,
+    "data/test-abidiff-exit/test-quick-check-report.txt",
+    "output/test-abidiff-exit/test-quick-check-report-3.txt"
+  },
+  {
+    "data/test-abidiff-exit/test-net-change-v0.o",
+    "data/test-abidiff-exit/test-net-change-v1.o",
+    "data/test-abidiff-exit/test-net-change.abignore",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "--no-default-suppression --no-show-locs --quick-check",
+    abigail::tools_utils::ABIDIFF_OK,
+    "data/test-abidiff-exit/test-quick-check-report.txt",
+    "output/test-abidiff-exit/test-quick-check-report-4.txt"
+  },
+  {
+    "data/test-abidiff-exit/test-PR30034/reference/lib64/librte_eal.so.23.1",
+    "data/test-abidiff-exit/test-PR30034/reference/lib64/librte_eal.so.23.1",
+    "",
+    "",
+    "",
+    "",
+    "",
+    "data/test-abidiff-exit/test-PR30034/reference/lib64",
+    "data/test-abidiff-exit/test-PR30034/reference/lib64",
+    "--no-default-suppression --follow-dependencies --quick-check",
+    abigail::tools_utils::ABIDIFF_OK,
+    "data/test-abidiff-exit/test-quick-check-report.txt",
+    "output/test-abidiff-exit/test-quick-check-report-5.txt"
+  },
+  {
+    "data/test-abidiff-exit/test-PR30034/reference/lib64/librte_eal.so.23.1",
+    "data/test-abidiff-exit/test-PR30034/split/lib64/librte_eal.so.23.2",
+    "data/test-abidiff-exit/test-PR30034/libabigail.abignore",
+    "data/test-abidiff-exit/test-PR30034/reference/include",
+    "data/test-abidiff-exit/test-PR30034/split/include",
+    "",
+    "",
+    "data/test-abidiff-exit/test-PR30034/reference/lib64",
+    "data/test-abidiff-exit/test-PR30034/split/lib64",
+    "--no-default-suppression --no-added-syms --follow-dependencies "
+    "--quick-check",
+    abigail::tools_utils::ABIDIFF_OK,
+    "data/test-abidiff-exit/test-quick-check-report.txt",
+    "output/test-abidiff-exit/test-quick-check-report-6.txt"
+  },
 #ifdef WITH_BTF
   {
     "data/test-abidiff-exit/btf/test0-v0.o",
@@ -1380,6 +1488,62 @@ main()
 					     total_count);
       }
 
+    // Re-apply the suppression specifications for each line read
+    // from the standard input, as abidiff --reload-suppressions does.
+    // The report is emitted once before reading the standard input,
+    // and once more for the line of the input.
+    {
+      bool is_ok = true;
+      string prefix = "data/test-abidiff-exit/test-reload-suppressions";
+      ref_diff_report_path = source_dir_prefix + prefix + "-report.txt";
+      out_diff_report_path = build_dir_prefix
+	+ "output/test-abidiff-exit/test-reload-suppressions-report.txt";
+      if (!ensure_parent_dir_created(out_diff_report_path))
+	{
+	  cerr << "could not create parent directory for "
+	       << out_diff_report_path
+	       << "\n";
+	  is_ok = false;
+	}
+
+      cmd = string(get_build_dir()) + "/tools/abidiff"
+	+ " --no-default-suppression --no-show-locs --reload-suppressions"
+	+ " --suppressions " + source_dir_prefix + prefix + ".abignore"
+	+ " " + source_dir_prefix + prefix + "-v0.o"
+	+ " " + source_dir_prefix + prefix + "-v1.o"
+	+ " < " + source_dir_prefix + prefix + "-input.txt"
+	+ " > " + out_diff_report_path;
+
+      if (is_ok)
+	{
+	  int code = system(cmd.c_str());
+	  if (!WIFEXITED(code)
+	      || (static_cast<abidiff_status>(WEXITSTATUS(code))
+		  != abigail::tools_utils::ABIDIFF_ABI_CHANGE))
+	    {
+	      cerr << "for command '"
+		   << cmd
+		   << "', expected abidiff status to be "
+		   << abigail::tools_utils::ABIDIFF_ABI_CHANGE << "\n";
+	      is_ok = false;
+	    }
+	}
+
+      if (is_ok)
+	{
+	  diff_cmd = "diff -u " + ref_diff_report_path
+	    + " " + out_diff_report_path;
+	  if (system(diff_cmd.c_str()))
+	    is_ok = false;
+	}
+
+      emit_test_status_and_update_counters(is_ok,
+					   cmd,
+					   passed_count,
+					   failed_count,
+					   total_count);
+    }
+
     emit_test_summary(total_count, passed_count, failed_count);
 
 
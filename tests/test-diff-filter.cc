@@ -836,6 +836,20 @@ InOutSpec in_out_specs[] =
     "data/test-diff-filter/test-PR29811-0-report-1.txt",
     "output/test-diff-filter/test-PR29811-0-report-1.txt",
   },
+  {
+    "data/test-diff-filter/test48-shared-parm-type-change-v0.o",
+    "data/test-diff-filter/test48-shared-parm-type-change-v1.o",
+    "--no-default-suppression --redundant",
+    "data/test-diff-filter/test48-shared-parm-type-change-report-0.txt",
+    "output/test-diff-filter/test48-shared-parm-type-change-report-0.txt",
+  },
+  {
+    "data/test-diff-filter/libtest49-leaf-shared-by-ifaces-v0.so",
+    "data/test-diff-filter/libtest49-leaf-shared-by-ifaces-v1.so",
+    "--no-default-suppression --leaf-changes-only --impacted-interfaces",
+    "data/test-diff-filter/test49-leaf-shared-by-ifaces-report-0.txt",
+    "output/test-diff-filter/test49-leaf-shared-by-ifaces-report-0.txt",
+  },
 #ifdef WITH_CTF
   {
    "data/test-diff-filter/test-PR29811-unknown-size-array-dwarf-ctf-DWARF.o",
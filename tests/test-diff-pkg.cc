@@ -149,6 +149,20 @@ static InOutSpec in_out_specs[] =
     "data/test-diff-pkg/dirpkg-3-report-2.txt",
     "output/test-diff-pkg/dirpkg-3-report-2.txt"
   },
+  // The two directories contain the same stripped binary but its
+  // split debug info changed.  The change must be reported.
+  {
+    "data/test-diff-pkg/dirpkg-4-dir1",
+    "data/test-diff-pkg/dirpkg-4-dir2",
+    "--no-default-suppression --no-show-locs",
+    "",
+    "data/test-diff-pkg/dirpkg-4-debug-dir1",
+    "data/test-diff-pkg/dirpkg-4-debug-dir2",
+    "",
+    "",
+    "data/test-diff-pkg/dirpkg-4-report-0.txt",
+    "output/test-diff-pkg/dirpkg-4-report-0.txt"
+  },
   {
     "data/test-diff-pkg/symlink-dir-test1/dir1/targets",
     "data/test-diff-pkg/symlink-dir-test1/dir2/targets",
@@ -2166,6 +2166,16 @@ InOutSpec in_out_specs[] =
     "data/test-diff-suppr/libtest48-soname-abixml-report-1.txt",
     "output/test-diff-suppr/libtest48-soname-abixml-report-1_suppr4.txt"
   },
+  {
+    "data/test-diff-suppr/test49-same-type-in-two-headers-v0.abi",
+    "data/test-diff-suppr/test49-same-type-in-two-headers-v1.abi",
+    "",
+    "",
+    "data/test-diff-suppr/test49-same-type-in-two-headers.suppr",
+    "--no-default-suppression --no-show-locs --no-redundant",
+    "data/test-diff-suppr/test49-same-type-in-two-headers-report-0.txt",
+    "output/test-diff-suppr/test49-same-type-in-two-headers-report-0.txt"
+  },
   {
     "data/test-diff-suppr/PR27267/libtestpr27267-v0.so",
     "data/test-diff-suppr/PR27267/libtestpr27267-v1.so",
@@ -15,7 +15,10 @@
 #include <string>
 #include <fstream>
 #include <iostream>
+#include <sstream>
 #include <cstdlib>
+#include <vector>
+#include "abg-ini.h"
 #include "abg-tools-utils.h"
 #include "test-utils.h"
 
@@ -53,6 +56,24 @@ InOutSpec in_out_specs[] =
     "data/test-ini/test02-buggy-property-value.abignore.expected",
     "output/test-ini/test02-buggy-property-value.abignore",
     ""
+  },
+  {
+    "data/test-ini/test03-escapes-across-runs.abignore",
+    "data/test-ini/test03-escapes-across-runs.abignore.expected",
+    "output/test-ini/test03-escapes-across-runs.abignore",
+    ""
+  },
+  {
+    "data/test-ini/test04-no-final-newline.abignore",
+    "data/test-ini/test04-no-final-newline.abignore.expected",
+    "output/test-ini/test04-no-final-newline.abignore",
+    ""
+  },
+  {
+    "data/test-ini/test05-empty.abignore",
+    "data/test-ini/test05-empty.abignore.expected",
+    "output/test-ini/test05-empty.abignore",
+    ""
   }
   ,
   // This one must always remain the last one.
@@ -83,6 +104,73 @@ get_tools_build_dir()
   return string(get_build_dir()) + "/tools";
 }
 
+/// Test that reading an ini config from an input stream takes the
+/// state of the stream into account.
+///
+/// @return true iff the test passed.
+static bool
+test_read_config_from_stream_states()
+{
+  using abigail::ini::config_sptr;
+  using abigail::ini::read_config;
+
+  // A stream in a bad state cannot be read from.
+  std::istringstream bad_stream("[suppress_function]\n  name = foo\n");
+  bad_stream.setstate(std::ios::badbit);
+  if (read_config(bad_stream))
+    return false;
+
+  // An empty stream holds an empty config.
+  std::istringstream empty_stream("");
+  config_sptr conf = read_config(empty_stream);
+  if (!conf || !conf->get_sections().empty())
+    return false;
+
+  // So does a stream that was read up to its end already.
+  std::istringstream consumed_stream("[suppress_function]\n  name = foo\n");
+  string content;
+  std::getline(consumed_stream, content, '\0');
+  conf = read_config(consumed_stream);
+  if (!conf || !conf->get_sections().empty())
+    return false;
+
+  return true;
+}
+
+/// Test that reading a function call expression from an input stream
+/// only consumes the characters of the expression.
+///
+/// @return true iff the test passed.
+static bool
+test_read_function_call_expr_from_stream()
+{
+  using abigail::ini::function_call_expr_sptr;
+  using abigail::ini::read_function_call_expr;
+
+  std::istringstream in("foo(a, b) bar(c)");
+  function_call_expr_sptr expr;
+  if (!read_function_call_expr(in, expr)
+      || expr->get_name() != "foo"
+      || expr->get_arguments() != std::vector<string>({"a", "b"}))
+    return false;
+
+  // The rest of the stream is left for the caller to read.
+  string rest;
+  std::getline(in, rest);
+  if (rest != " bar(c)")
+    return false;
+
+  // Including another function call expression.
+  in.clear();
+  in.str(rest);
+  if (!read_function_call_expr(in, expr)
+      || expr->get_name() != "bar"
+      || expr->get_arguments() != std::vector<string>({"c"}))
+    return false;
+
+  return true;
+}
+
 int
 main()
 {
@@ -141,6 +229,15 @@ main()
 					   failed_count, total_count);
     }
 
+  emit_test_status_and_update_counters(test_read_config_from_stream_states(),
+				       "test_read_config_from_stream_states",
+				       passed_count, failed_count, total_count);
+
+  emit_test_status_and_update_counters
+    (test_read_function_call_expr_from_stream(),
+     "test_read_function_call_expr_from_stream",
+     passed_count, failed_count, total_count);
+
   emit_test_summary(total_count, passed_count, failed_count);
 
   return failed_count;
@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// -*- Mode: C++ -*-
+//
+// Copyright (C) 2025 Red Hat, Inc.
+
+/// @file
+///
+/// This program tests diff_utils::compute_keyed_diff, as used by
+/// compute_diff for corpora to match the functions and ELF symbols of
+/// two corpora.
+///
+/// In particular, it checks that a symbol or a function is matched
+/// with its counterpart when their symbols are aliases, even when the
+/// main symbol of the alias set got renamed.
+
+#include <string>
+#include <vector>
+
+#include "lib/catch.hpp"
+
+#include "abg-comparison-priv.h"
+#include "abg-diff-utils.h"
+#include "abg-ir.h"
+
+using std::string;
+using std::vector;
+
+using namespace abigail;
+
+using diff_utils::compute_keyed_diff;
+using diff_utils::deep_ptr_eq_functor;
+using diff_utils::edit_script;
+using ir::elf_symbol;
+using ir::elf_symbol_sptr;
+using ir::elf_symbols;
+using ir::environment;
+using ir::function_decl;
+using ir::function_decl_sptr;
+using ir::function_type;
+using ir::function_type_sptr;
+using ir::type_base_sptr;
+using ir::type_decl;
+
+/// Create a global defined function symbol.
+///
+/// @param env the environment to create the symbol in.
+///
+/// @param name the name of the symbol.
+///
+/// @return the new symbol.
+static elf_symbol_sptr
+new_function_symbol(const environment& env, const string& name)
+{
+  return elf_symbol::create(env, /*index=*/0, /*size=*/0, name,
+			    elf_symbol::FUNC_TYPE,
+			    elf_symbol::GLOBAL_BINDING,
+			    /*is_defined=*/true,
+			    /*is_common=*/false,
+			    elf_symbol::version(),
+			    elf_symbol::DEFAULT_VISIBILITY);
+}
+
+/// Compute the keyed diff of two vectors of ELF symbols.
+///
+/// @param first the first vector of symbols.
+///
+/// @param second the second vector of symbols.
+///
+/// @param ses the resulting edit script.
+static void
+compute_symbols_diff(const elf_symbols& first,
+		     const elf_symbols& second,
+		     edit_script& ses)
+{
+  compute_keyed_diff<elf_symbols::const_iterator,
+		     deep_ptr_eq_functor,
+		     comparison::elf_symbol_diff_key>
+    (first.begin(), first.end(), second.begin(), second.end(), ses);
+}
+
+TEST_CASE("KeyedDiffOfSymbols", "[keyed-diff]")
+{
+  environment env;
+
+  // foo, baz, qux versus foo, baz, quux: qux is deleted and quux is
+  // inserted after baz.
+  elf_symbols first = {new_function_symbol(env, "foo"),
+		       new_function_symbol(env, "baz"),
+		       new_function_symbol(env, "qux")};
+  elf_symbols second = {new_function_symbol(env, "foo"),
+			new_function_symbol(env, "baz"),
+			new_function_symbol(env, "quux")};
+  edit_script ses;
+  compute_symbols_diff(first, second, ses);
+  REQUIRE(ses.num_deletions() == 1);
+  CHECK(ses.deletions()[0].index() == 2);
+  REQUIRE(ses.num_insertions() == 1);
+  CHECK(ses.insertions()[0].insertion_point_index() == 1);
+  REQUIRE(ses.insertions()[0].inserted_indexes().size() == 1);
+  CHECK(ses.insertions()[0].inserted_indexes()[0] == 2);
+}
+
+TEST_CASE("KeyedDiffOfSymbolsWithRenamedMainSymbol", "[keyed-diff]")
+{
+  environment env;
+
+  // In the first set, foo is the main symbol and bar is its alias.
+  elf_symbol_sptr foo1 = new_function_symbol(env, "foo");
+  elf_symbol_sptr bar1 = new_function_symbol(env, "bar");
+  foo1->add_alias(bar1);
+
+  // In the second set, bar became the main symbol and foo is its
+  // alias.
+  elf_symbol_sptr bar2 = new_function_symbol(env, "bar");
+  elf_symbol_sptr foo2 = new_function_symbol(env, "foo");
+  bar2->add_alias(foo2);
+
+  REQUIRE(*foo1 == *bar2);
+
+  // Both sets have one symbol that is not aliased.
+  elf_symbols first = {foo1, new_function_symbol(env, "baz")};
+  elf_symbols second = {new_function_symbol(env, "baz"), bar2};
+
+  edit_script ses;
+  compute_symbols_diff(first, second, ses);
+  CHECK(ses.num_deletions() == 0);
+  CHECK(ses.num_insertions() == 0);
+
+  // Keying only on the ID string of the main symbol would report foo
+  // as deleted and bar as added.
+  vector<string> keys1, keys2;
+  comparison::elf_symbol_diff_key()(foo1, keys1);
+  comparison::elf_symbol_diff_key()(bar2, keys2);
+  CHECK(keys1 == vector<string>({"foo", "bar"}));
+  CHECK(keys2 == vector<string>({"bar", "foo"}));
+
+  // An alias yields the ID string of its main symbol as well.
+  keys1.clear();
+  comparison::elf_symbol_diff_key()(bar1, keys1);
+  CHECK(keys1 == vector<string>({"bar", "foo"}));
+
+  // Dropping the alias makes the symbols different, so they are not
+  // matched.
+  elf_symbols third = {new_function_symbol(env, "bar")};
+  ses = edit_script();
+  compute_symbols_diff(elf_symbols({foo1}), third, ses);
+  CHECK(ses.num_deletions() == 1);
+  CHECK(ses.num_insertions() == 1);
+}
+
+TEST_CASE("KeyedDiffOfFunctionsWithRenamedMainSymbol", "[keyed-diff]")
+{
+  environment env;
+
+  type_base_sptr int_type(new type_decl(env, "int", 32, 32, ir::location()));
+  function_type_sptr fn_type(new function_type(int_type, 64, 64));
+
+  // The function foo of the first set has the symbol foo, aliased by
+  // bar.  The function of the second set is named bar and has the
+  // symbol bar, aliased by foo.
+  // Aliases are only weakly referenced, so they are kept alive here.
+  elf_symbol_sptr foo1 = new_function_symbol(env, "foo");
+  elf_symbol_sptr bar1 = new_function_symbol(env, "bar");
+  foo1->add_alias(bar1);
+  elf_symbol_sptr bar2 = new_function_symbol(env, "bar");
+  elf_symbol_sptr foo2 = new_function_symbol(env, "foo");
+  bar2->add_alias(foo2);
+
+  function_decl_sptr f1(new function_decl("foo", fn_type,
+					   /*declared_inline=*/false,
+					   ir::location(), "foo"));
+  f1->set_symbol(foo1);
+  function_decl_sptr f2(new function_decl("bar", fn_type,
+					   /*declared_inline=*/false,
+					   ir::location(), "bar"));
+  f2->set_symbol(bar2);
+
+  REQUIRE(*f1 == *f2);
+
+  // The function IDs differ, but the functions share keys.
+  CHECK(f1->get_id() != f2->get_id());
+  vector<string> keys1, keys2;
+  comparison::function_decl_diff_key()(f1.get(), keys1);
+  comparison::function_decl_diff_key()(f2.get(), keys2);
+  CHECK(keys1 == vector<string>({"foo", "bar"}));
+  CHECK(keys2 == vector<string>({"bar", "foo"}));
+
+  vector<const function_decl*> first = {f1.get()}, second = {f2.get()};
+  edit_script ses;
+  compute_keyed_diff<vector<const function_decl*>::const_iterator,
+		     deep_ptr_eq_functor,
+		     comparison::function_decl_diff_key>
+    (first.begin(), first.end(), second.begin(), second.end(), ses);
+  CHECK(ses.num_deletions() == 0);
+  CHECK(ses.num_insertions() == 0);
+}
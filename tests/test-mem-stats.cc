@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// -*- Mode: C++ -*-
+//
+// Copyright (C) 2025 Red Hat, Inc.
+
+/// @file
+///
+/// This program tests the accounting of the memory used by the
+/// internal representation, that is, corpus::record_memory_stats,
+/// environment::record_memory_stats, dump_memory_stats and the
+/// --mem-stats option of abidw.
+///
+/// The number of bytes depends on the platform, so only the number
+/// of instances of the artifacts and the consistency of the report
+/// are checked.
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "lib/catch.hpp"
+
+#include "abg-corpus.h"
+#include "abg-ir.h"
+#include "abg-reader.h"
+#include "abg-tools-utils.h"
+#include "test-utils.h"
+
+using std::string;
+
+using namespace abigail;
+
+using ir::environment;
+using ir::memory_stats_type;
+
+TEST_CASE("CorpusMemoryStats", "[mem-stats]")
+{
+  const string path =
+    string(tests::get_src_dir())
+    + "/tests/data/test-diff-suppr/test49-same-type-in-two-headers-v0.abi";
+
+  environment env;
+  corpus_sptr corp = abixml::read_corpus_from_abixml_file(path, env);
+  REQUIRE(corp);
+
+  memory_stats_type stats;
+  corp->record_memory_stats(stats);
+
+  // The corpus has two translation units, each defining a function
+  // that takes a pointer to its own definition of the struct S.
+  CHECK(stats["translation_unit"].count == 2);
+  CHECK(stats["function_decl"].count == 2);
+  CHECK(stats["class_decl"].count == 2);
+  CHECK(stats["pointer_type_def"].count == 2);
+  CHECK(stats["elf_symbol"].count == 2);
+
+  for (const auto& i : stats)
+    if (i.second.count)
+      CHECK(i.second.bytes > 0);
+
+  // Recording the statistics again adds up to the previous ones.
+  memory_stats_type twice = stats;
+  corp->record_memory_stats(twice);
+  CHECK(twice["function_decl"].count == 4);
+
+  env.record_memory_stats(stats);
+  CHECK(stats.count("interned strings"));
+
+  // The report shows each kind of artifact and their total.
+  size_t total_count = 0, total_bytes = 0;
+  for (const auto& i : stats)
+    {
+      total_count += i.second.count;
+      total_bytes += i.second.bytes;
+    }
+
+  std::ostringstream o;
+  ir::dump_memory_stats(stats, o);
+  const string report = o.str();
+  CHECK(report.find("function_decl: 2 instances, ") != string::npos);
+  std::ostringstream total;
+  total << "total: " << total_count << " instances, "
+	<< total_bytes << " bytes\n";
+  CHECK(report.size() >= total.str().size());
+  CHECK(report.compare(report.size() - total.str().size(),
+		       total.str().size(), total.str()) == 0);
+}
+
+TEST_CASE("AbidwMemStats", "[mem-stats]")
+{
+  const string in_elf_path =
+    string(tests::get_src_dir()) + "/tests/data/test-read-dwarf/test0";
+  const string out_path =
+    string(tests::get_build_dir()) + "/tests/output/test-mem-stats.txt";
+  const string cmd =
+    string(tests::get_build_dir()) + "/tools/abidw --noout --mem-stats "
+    + in_elf_path + " 2> " + out_path;
+
+  REQUIRE(tools_utils::ensure_parent_dir_created(out_path));
+  REQUIRE(system(cmd.c_str()) == 0);
+
+  std::ifstream in(out_path);
+  REQUIRE(in.good());
+  std::stringstream content;
+  content << in.rdbuf();
+  const string report = content.str();
+
+  CHECK(report.find("memory used by the internal representation of '"
+		    + in_elf_path + "':\n") != string::npos);
+  CHECK(report.find("\ntranslation_unit: ") != string::npos);
+  CHECK(report.find("\ntotal: ") != string::npos);
+}
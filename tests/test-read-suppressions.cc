@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// -*- Mode: C++ -*-
+//
+// Copyright (C) 2025 Red Hat, Inc.
+
+/// @file
+///
+/// This program tests the reading of suppression specification files
+/// by suppr::read_suppressions.
+///
+/// The parsed form of these files is cached, so this checks that a
+/// file that is modified on disk is parsed again, and that the same
+/// file can be read by several threads at once.
+
+#include <utime.h>
+#include <ctime>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lib/catch.hpp"
+
+#include "abg-suppression.h"
+#include "abg-tools-utils.h"
+#include "test-utils.h"
+
+using std::string;
+using std::vector;
+
+using namespace abigail;
+
+using suppr::function_suppression_sptr;
+using suppr::suppressions_type;
+using suppr::variable_suppression_sptr;
+
+/// Write a suppression specification file.
+///
+/// @param path the path to the file to write.
+///
+/// @param content the content of the file.
+///
+/// @param mtime the modification time to set to the file, or zero to
+/// leave the current time.
+static void
+write_suppression_file(const string& path,
+		       const string& content,
+		       time_t mtime = 0)
+{
+  {
+    std::ofstream out(path, std::ios::trunc);
+    REQUIRE(out.good());
+    out << content;
+  }
+  if (mtime)
+    {
+      struct utimbuf times;
+      times.actime = mtime;
+      times.modtime = mtime;
+      REQUIRE(utime(path.c_str(), &times) == 0);
+    }
+}
+
+/// Read a suppression specification file made of one function or
+/// variable suppression.
+///
+/// @param path the path to the file to read.
+///
+/// @return the kind of the suppression, followed by its name, e.g
+/// "function foo".
+static string
+read_single_suppression(const string& path)
+{
+  suppressions_type supprs;
+  suppr::read_suppressions(path, supprs);
+  if (supprs.size() != 1)
+    return "";
+  if (function_suppression_sptr s = suppr::is_function_suppression(supprs[0]))
+    return "function " + s->get_name();
+  if (variable_suppression_sptr s = suppr::is_variable_suppression(supprs[0]))
+    return "variable " + s->get_name();
+  return "";
+}
+
+TEST_CASE("ReadModifiedSuppressionFile", "[read_suppressions]")
+{
+  const string path =
+    string(tests::get_build_dir())
+    + "/tests/output/test-read-suppressions/modified.abignore";
+  REQUIRE(tools_utils::ensure_parent_dir_created(path));
+
+  const time_t past = time(nullptr) - 100;
+
+  write_suppression_file(path, "[suppress_function]\n  name = foo\n", past);
+  CHECK(read_single_suppression(path) == "function foo");
+  CHECK(read_single_suppression(path) == "function foo");
+
+  // Same size, new modification time.
+  write_suppression_file(path, "[suppress_function]\n  name = bar\n",
+			 past + 10);
+  CHECK(read_single_suppression(path) == "function bar");
+
+  // New size, same modification time.
+  write_suppression_file(path, "[suppress_variable]\n  name = bar\n",
+			 past + 10);
+  CHECK(read_single_suppression(path) == "variable bar");
+
+  // Modified twice within the same second, with the same size.
+  write_suppression_file(path, "[suppress_function]\n  name = baz\n");
+  CHECK(read_single_suppression(path) == "function baz");
+  write_suppression_file(path, "[suppress_function]\n  name = qux\n");
+  CHECK(read_single_suppression(path) == "function qux");
+}
+
+TEST_CASE("ReadSuppressionFileConcurrently", "[read_suppressions]")
+{
+  const string path =
+    string(tests::get_build_dir())
+    + "/tests/output/test-read-suppressions/concurrent.abignore";
+  REQUIRE(tools_utils::ensure_parent_dir_created(path));
+
+  // The list and tuple properties have a lazily built string
+  // representation.
+  write_suppression_file(path,
+			 "[suppress_type]\n"
+			 "  name = S\n"
+			 "  source_location_not_in = foo.h, bar.h\n"
+			 "  has_data_member_inserted_between = {8, end}\n",
+			 time(nullptr) - 100);
+
+  const size_t num_threads = 4;
+  vector<unsigned> num_read(num_threads, 0);
+  vector<std::thread> threads;
+  for (size_t t = 0; t < num_threads; ++t)
+    threads.push_back(std::thread([&path, &num_read, t]()
+      {
+	for (size_t i = 0; i < 100; ++i)
+	  {
+	    suppressions_type supprs;
+	    suppr::read_suppressions(path, supprs);
+	    if (supprs.size() == 1 && suppr::is_type_suppression(supprs[0]))
+	      ++num_read[t];
+	  }
+      }));
+  for (std::thread& t : threads)
+    t.join();
+
+  for (unsigned n : num_read)
+    CHECK(n == 100);
+}
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// -*- Mode: C++ -*-
+//
+// Copyright (C) 2025 Red Hat, Inc.
+
+/// @file
+///
+/// This program tests that applying a new set of suppression
+/// specifications to the changes of an existing corpus_diff, with
+/// corpus_diff::reapply_filters_and_suppressions, gives the same
+/// report as computing the changes again with that set of suppression
+/// specifications.
+
+#include <sstream>
+#include <string>
+
+#include "lib/catch.hpp"
+
+#include "abg-comparison.h"
+#include "abg-corpus.h"
+#include "abg-reader.h"
+#include "abg-suppression.h"
+#include "test-utils.h"
+
+using namespace abigail;
+
+using comparison::compute_diff;
+using comparison::corpus_diff_sptr;
+using comparison::diff_context;
+using comparison::diff_context_sptr;
+using ir::environment;
+using suppr::read_suppressions;
+using suppr::suppressions_type;
+
+static const std::string test_data_dir =
+    std::string(abigail::tests::get_src_dir()) + "/tests/data/test-diff-suppr/";
+
+/// Emit the report of a corpus_diff into a string.
+///
+/// @param d the corpus_diff to consider.
+///
+/// @return the report of @p d.
+static std::string
+get_report(const corpus_diff_sptr& d)
+{
+  std::ostringstream o;
+  d->report(o);
+  return o.str();
+}
+
+/// Compute the changes between two corpora with a given set of
+/// suppression specifications, and emit their report into a string.
+///
+/// @param c1 the first corpus to consider.
+///
+/// @param c2 the second corpus to consider.
+///
+/// @param supprs the suppression specifications to apply.
+///
+/// @return the report of the changes between @p c1 and @p c2.
+static std::string
+get_report_of_new_diff(const corpus_sptr& c1,
+		       const corpus_sptr& c2,
+		       const suppressions_type& supprs)
+{
+  diff_context_sptr ctxt(new diff_context);
+  ctxt->show_locs(false);
+  ctxt->add_suppressions(supprs);
+  return get_report(compute_diff(c1, c2, ctxt));
+}
+
+TEST_CASE("ReapplySuppressions", "[suppressions]")
+{
+  environment env;
+  corpus_sptr c1 = abixml::read_corpus_from_abixml_file
+    (test_data_dir + "test49-same-type-in-two-headers-v0.abi", env);
+  corpus_sptr c2 = abixml::read_corpus_from_abixml_file
+    (test_data_dir + "test49-same-type-in-two-headers-v1.abi", env);
+  REQUIRE(c1);
+  REQUIRE(c2);
+
+  suppressions_type no_supprs, supprs;
+  read_suppressions(test_data_dir + "test49-same-type-in-two-headers.suppr",
+		    supprs);
+  REQUIRE(!supprs.empty());
+
+  const std::string unsuppressed_report =
+    get_report_of_new_diff(c1, c2, no_supprs);
+  const std::string suppressed_report =
+    get_report_of_new_diff(c1, c2, supprs);
+  REQUIRE(unsuppressed_report != suppressed_report);
+
+  diff_context_sptr ctxt(new diff_context);
+  ctxt->show_locs(false);
+  corpus_diff_sptr d = compute_diff(c1, c2, ctxt);
+  CHECK(get_report(d) == unsuppressed_report);
+
+  // Add the suppression specifications to the existing diff.
+  ctxt->add_suppressions(supprs);
+  d->reapply_filters_and_suppressions();
+  CHECK(get_report(d) == suppressed_report);
+
+  // Re-applying the same suppression specifications twice gives the
+  // same result.
+  d->reapply_filters_and_suppressions();
+  CHECK(get_report(d) == suppressed_report);
+
+  // Remove the suppression specifications from the existing diff.
+  ctxt->suppressions().clear();
+  d->reapply_filters_and_suppressions();
+  CHECK(get_report(d) == unsuppressed_report);
+}
@@ -0,0 +1,256 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// -*- Mode: C++ -*-
+//
+// Copyright (C) 2025 Red Hat, Inc.
+
+/// @file
+///
+/// This program tests the regular expression helpers of abg-regex.h.
+///
+/// In particular, it tests that regex::match gives the same results
+/// as regexec, whether or not the regular expression is matched
+/// without the regex engine, as a set of literal strings.  It also
+/// tests the literal prefixes and suffixes found by
+/// regex::get_literal_prefix and regex::get_literal_suffix.
+
+#include <regex.h>
+#include <string>
+#include <vector>
+
+#include "lib/catch.hpp"
+
+#include "abg-regex-priv.h"
+
+using namespace abigail;
+
+using regex::compiled_regex_t_deleter;
+using regex::regex_t_sptr;
+
+/// The strings the regular expressions of these tests are matched
+/// against.
+static const char* subjects[] =
+{
+  "",
+  "a",
+  "b",
+  "c",
+  "ac",
+  "bc",
+  "abc",
+  "xacy",
+  "$",
+  "a$",
+  "xa$y",
+  "\\",
+  "a\\",
+  "a\\$",
+  "]",
+  "x]y",
+  "{",
+  "x{y",
+  "()",
+  "(a|)",
+  "foo",
+  "foo$",
+  "xfoo$",
+  "foobar",
+  "barfoo",
+};
+
+/// Test if a regular expression is matched without the regex engine.
+///
+/// @param r the compiled regular expression to consider.
+///
+/// @return true iff @p r is matched as a set of literal strings.
+static bool
+is_matched_literally(const regex_t_sptr& r)
+{
+  compiled_regex_t_deleter* d = std::get_deleter<compiled_regex_t_deleter>(r);
+  return d && d->matcher;
+}
+
+/// Check that regex::match gives the same results as regexec for a
+/// given regular expression, on all the test subjects.
+///
+/// @param re the string representation of the regular expression to
+/// consider.
+static void
+check_match_is_like_regexec(const std::string& re)
+{
+  INFO("regex: " << re);
+
+  regex_t raw;
+  bool raw_compiled = !regcomp(&raw, re.c_str(), REG_EXTENDED);
+
+  regex_t_sptr r = regex::compile(re);
+  REQUIRE(bool(r) == raw_compiled);
+  if (!raw_compiled)
+    return;
+
+  for (const char* s : subjects)
+    {
+      INFO("subject: " << s);
+      CHECK(regex::match(r, s) == !regexec(&raw, s, 0, NULL, 0));
+    }
+  regfree(&raw);
+}
+
+TEST_CASE("MatchLikeRegexec", "[regex]")
+{
+  const std::vector<std::string> regexes =
+    {
+      // Escaped '$'.
+      "\\$",
+      "a\\$",
+      "^a\\$",
+      "a\\$$",
+      "^\\$$",
+      // An escaped backslash followed by an end anchor.
+      "\\\\$",
+      "a\\\\$",
+      "^a\\\\$",
+      // Anchors without a literal.
+      "^$",
+      "^",
+      "$",
+      // Groups and alternatives that are not a set of literals.
+      "()",
+      "(a|)",
+      "(|a)",
+      "(a|b)c",
+      "c(a|b)",
+      "a|",
+      // Special characters that regcomp might accept as literals.
+      "]",
+      "x]y",
+      "{",
+      "x{y",
+      // Escaped special characters.
+      "x\\]y",
+      "x\\{y",
+      "\\(\\)",
+      // Sets of literals.
+      "a",
+      "^a",
+      "a$",
+      "^a$",
+      "abc",
+      "^abc$",
+      "(a|b)",
+      "^(a|b)$",
+      "^(foo|foo\\$)$",
+      // Not literals.
+      "a|b",
+      "^a|b$",
+      "foo|bar",
+      "a*",
+      "a.c",
+      "[ab]c",
+      "a\\w",
+    };
+
+  for (const std::string& re : regexes)
+    check_match_is_like_regexec(re);
+}
+
+TEST_CASE("MatchLiterally", "[regex]")
+{
+  // These are matched without the regex engine.
+  CHECK(is_matched_literally(regex::compile("a\\$")));
+  CHECK(is_matched_literally(regex::compile("\\\\$")));
+  CHECK(is_matched_literally(regex::compile("^abc$")));
+  CHECK(is_matched_literally(regex::compile("^(a|b)$")));
+
+  // These are left to the regex engine.
+  CHECK(!is_matched_literally(regex::compile("^$")));
+  CHECK(!is_matched_literally(regex::compile("()")));
+  CHECK(!is_matched_literally(regex::compile("(a|)")));
+  CHECK(!is_matched_literally(regex::compile("(a|b)c")));
+  CHECK(!is_matched_literally(regex::compile("]")));
+  CHECK(!is_matched_literally(regex::compile("foo|bar")));
+  CHECK(!is_matched_literally(regex::compile("a\\w")));
+}
+
+/// Get the literal prefix of a regular expression, as a string.
+///
+/// @param r the string representation of the regular expression.
+///
+/// @return "none" if regex::get_literal_prefix finds no literal
+/// prefix for @p r.  Otherwise, return the prefix, followed by
+/// " (exact)" if @p r matches exactly that prefix.
+static std::string
+get_prefix(const std::string& r)
+{
+  std::string prefix;
+  bool is_exact = false;
+  if (!regex::get_literal_prefix(r, prefix, is_exact))
+    return "none";
+  return is_exact ? prefix + " (exact)" : prefix;
+}
+
+/// Get the literal suffix of a regular expression, as a string.
+///
+/// @param r the string representation of the regular expression.
+///
+/// @return "none" if regex::get_literal_suffix finds no literal
+/// suffix for @p r.  Otherwise, return the suffix.
+static std::string
+get_suffix(const std::string& r)
+{
+  std::string suffix;
+  if (!regex::get_literal_suffix(r, suffix))
+    return "none";
+  return suffix;
+}
+
+TEST_CASE("LiteralPrefix", "[regex]")
+{
+  CHECK(get_prefix("^foo") == "foo");
+  CHECK(get_prefix("^foo$") == "foo (exact)");
+  CHECK(get_prefix("^$") == " (exact)");
+  CHECK(get_prefix("^foo.*") == "foo");
+  CHECK(get_prefix("^a\\.b") == "a.b");
+  CHECK(get_prefix("^a\\$") == "a$");
+  CHECK(get_prefix("^a\\$$") == "a$ (exact)");
+  CHECK(get_prefix("^a\\\\$") == "a\\ (exact)");
+
+  // An optional or repeated last character is not part of the
+  // prefix.
+  CHECK(get_prefix("^fooo*") == "foo");
+  CHECK(get_prefix("^foo?") == "fo");
+  CHECK(get_prefix("^foo{2}") == "fo");
+  CHECK(get_prefix("^f*") == "none");
+
+  // An escape sequence that is not an escaped special character
+  // might be a character class, so it ends the prefix.
+  CHECK(get_prefix("^a\\wb") == "a");
+  CHECK(get_prefix("^\\w") == "none");
+
+  // Not anchored, or with an alternation.
+  CHECK(get_prefix("foo") == "none");
+  CHECK(get_prefix("^.*") == "none");
+  CHECK(get_prefix("^foo|bar") == "none");
+  CHECK(get_prefix("^(foo|bar)") == "none");
+  CHECK(get_prefix("") == "none");
+}
+
+TEST_CASE("LiteralSuffix", "[regex]")
+{
+  CHECK(get_suffix("foo$") == "foo");
+  CHECK(get_suffix(".*foo$") == "foo");
+  CHECK(get_suffix("^foo$") == "foo");
+  CHECK(get_suffix("a\\.b$") == "b");
+
+  // The first character after a backslash might not be a literal.
+  CHECK(get_suffix("\\wfoo$") == "foo");
+
+  // Not anchored, with an escaped '$', or with an alternation.
+  CHECK(get_suffix("foo") == "none");
+  CHECK(get_suffix("\\$") == "none");
+  CHECK(get_suffix("a\\$") == "none");
+  CHECK(get_suffix("a\\\\$") == "none");
+  CHECK(get_suffix("x*$") == "none");
+  CHECK(get_suffix("foo|bar$") == "none");
+  CHECK(get_suffix("$") == "none");
+  CHECK(get_suffix("") == "none");
+}
@@ -0,0 +1,289 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// -*- Mode: C++ -*-
+//
+// Copyright (C) 2025 Red Hat, Inc.
+
+/// @file
+///
+/// This program tests the index of suppression specifications,
+/// suppr::suppressions_index.
+///
+/// It checks that the index yields, in their original order, all the
+/// indexed suppression specifications that can match a given name,
+/// whether they designate names exactly, by a regular expression with
+/// a literal prefix or suffix, or by a regular expression that the
+/// index cannot reason about.
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "lib/catch.hpp"
+
+#include "abg-suppression.h"
+
+using std::string;
+using std::unordered_set;
+using std::vector;
+
+using namespace abigail;
+
+using suppr::function_suppression;
+using suppr::function_suppression_sptr;
+using suppr::suppressions_index;
+using suppr::suppressions_type;
+using suppr::type_suppression;
+using suppr::type_suppression_sptr;
+using suppr::variable_suppression;
+using suppr::variable_suppression_sptr;
+
+/// Get the labels of a vector of suppression specifications.
+///
+/// @param supprs the suppression specifications to consider.
+///
+/// @return the comma-separated list of the labels of @p supprs, in
+/// their order in @p supprs.
+template<typename suppression_sptr_type>
+static string
+get_labels(const vector<suppression_sptr_type>& supprs)
+{
+  string result;
+  for (const auto& s : supprs)
+    {
+      if (!result.empty())
+	result += ",";
+      result += s->get_label();
+    }
+  return result;
+}
+
+/// Create a function suppression specification with a given label.
+///
+/// @param label the label of the specification.
+///
+/// @return the new specification.
+static function_suppression_sptr
+new_function_suppression(const string& label)
+{
+  function_suppression_sptr s(new function_suppression);
+  s->set_label(label);
+  return s;
+}
+
+/// Create a variable suppression specification with a given label.
+///
+/// @param label the label of the specification.
+///
+/// @return the new specification.
+static variable_suppression_sptr
+new_variable_suppression(const string& label)
+{return variable_suppression_sptr(new variable_suppression(label));}
+
+/// Get the labels of the function suppression specifications that an
+/// index yields for a given function.
+///
+/// @param index the index to consider.
+///
+/// @param fn_name the name of the function.
+///
+/// @param fn_linkage_name the linkage name of the function.
+///
+/// @return the comma-separated list of the labels of the function
+/// suppression specifications yielded by @p index.
+static string
+lookup_function(const suppressions_index& index,
+		const string& fn_name,
+		const string& fn_linkage_name)
+{
+  vector<function_suppression_sptr> result;
+  index.get_function_suppressions(fn_name, fn_linkage_name, result);
+  return get_labels(result);
+}
+
+/// Get the labels of the variable suppression specifications that an
+/// index yields for a given variable.
+///
+/// @param index the index to consider.
+///
+/// @param var_name the name of the variable.
+///
+/// @param var_linkage_name the linkage name of the variable.
+///
+/// @return the comma-separated list of the labels of the variable
+/// suppression specifications yielded by @p index.
+static string
+lookup_variable(const suppressions_index& index,
+		const string& var_name,
+		const string& var_linkage_name)
+{
+  vector<variable_suppression_sptr> result;
+  index.get_variable_suppressions(var_name, var_linkage_name, result);
+  return get_labels(result);
+}
+
+/// Get the labels of the type suppression specifications that an
+/// index yields for a given type.
+///
+/// @param index the index to consider.
+///
+/// @param type_name the name of the type.
+///
+/// @return the comma-separated list of the labels of the type
+/// suppression specifications yielded by @p index.
+static string
+lookup_type(const suppressions_index& index, const string& type_name)
+{
+  vector<type_suppression_sptr> result;
+  index.get_type_suppressions(type_name, result);
+  return get_labels(result);
+}
+
+TEST_CASE("IndexFunctionSuppressions", "[suppressions_index]")
+{
+  suppressions_type supprs;
+  function_suppression_sptr s;
+
+  s = new_function_suppression("prefix");
+  s->set_name_regex_str("^foo");
+  supprs.push_back(s);
+
+  s = new_function_suppression("exact");
+  s->set_name("foo");
+  supprs.push_back(s);
+
+  s = new_function_suppression("suffix");
+  s->set_name_regex_str("_bar$");
+  supprs.push_back(s);
+
+  s = new_function_suppression("exact-regex");
+  s->set_name_regex_str("^baz$");
+  supprs.push_back(s);
+
+  s = new_function_suppression("any-regex");
+  s->set_name_regex_str(".*qux");
+  supprs.push_back(s);
+
+  s = new_function_suppression("invalid-regex");
+  s->set_name_regex_str("^foo(");
+  supprs.push_back(s);
+
+  s = new_function_suppression("name-not-regex");
+  s->set_name_not_regex_str("^foo");
+  supprs.push_back(s);
+
+  s = new_function_suppression("symbol-name");
+  s->set_symbol_name("foo_sym");
+  supprs.push_back(s);
+
+  s = new_function_suppression("symbol-name-not-in-set");
+  s->set_symbol_name_not_in_set(unordered_set<string>({"foo_sym"}));
+  supprs.push_back(s);
+
+  // This one has no name property so it can't match any function
+  // name.
+  supprs.push_back(new_function_suppression("no-name"));
+
+  suppressions_index index(supprs);
+  CHECK(index.get_suppressions() == supprs);
+  CHECK(index.has_function_suppressions());
+  CHECK(!index.has_variable_suppressions());
+
+  // The specifications whose regular expression has no literal
+  // prefix or suffix, is invalid, or is a "name_not_regexp" are
+  // yielded for any function name.
+  const string any = "any-regex,invalid-regex,name-not-regex";
+
+  CHECK(lookup_function(index, "foo", "") == "prefix,exact," + any);
+  CHECK(lookup_function(index, "foo_bar", "") == "prefix,suffix," + any);
+  CHECK(lookup_function(index, "x_bar", "") == "suffix," + any);
+  CHECK(lookup_function(index, "baz", "") == "exact-regex," + any);
+  CHECK(lookup_function(index, "bazz", "") == any);
+  CHECK(lookup_function(index, "fo", "") == any);
+
+  // The specifications yielded for the name and for the linkage name
+  // are merged, in their original order.
+  CHECK(lookup_function(index, "foo", "foo_sym")
+	== "prefix,exact," + any + ",symbol-name,symbol-name-not-in-set");
+  CHECK(lookup_function(index, "x", "foo_sym")
+	== any + ",symbol-name,symbol-name-not-in-set");
+  CHECK(lookup_function(index, "", "x") == "symbol-name-not-in-set");
+  CHECK(lookup_function(index, "", "") == "");
+
+  // Indexing another set forgets the previous one.
+  index.index_suppressions(suppressions_type());
+  CHECK(index.get_suppressions().empty());
+  CHECK(!index.has_function_suppressions());
+  CHECK(lookup_function(index, "foo", "foo_sym") == "");
+}
+
+TEST_CASE("IndexVariableSuppressions", "[suppressions_index]")
+{
+  suppressions_type supprs;
+  variable_suppression_sptr s;
+
+  s = new_variable_suppression("exact");
+  s->set_name("v");
+  supprs.push_back(s);
+
+  s = new_variable_suppression("symbol-prefix");
+  s->set_symbol_name_regex_str("^_ZN3foo");
+  supprs.push_back(s);
+
+  s = new_variable_suppression("symbol-not-regex");
+  s->set_symbol_name_not_regex_str("^_ZN3bar");
+  supprs.push_back(s);
+
+  s = new_variable_suppression("name-not-regex");
+  s->set_name_not_regex_str("^v$");
+  supprs.push_back(s);
+
+  s = new_variable_suppression("symbol-name-not-in-set");
+  s->set_symbol_name_not_in_set(unordered_set<string>({"_ZN3foo1vE"}));
+  supprs.push_back(s);
+
+  suppressions_index index(supprs);
+  CHECK(!index.has_function_suppressions());
+  CHECK(index.has_variable_suppressions());
+
+  CHECK(lookup_variable(index, "v", "") == "exact,name-not-regex");
+  CHECK(lookup_variable(index, "w", "_ZN3foo1vE")
+	== "symbol-prefix,symbol-not-regex,name-not-regex,"
+	"symbol-name-not-in-set");
+  CHECK(lookup_variable(index, "w", "_ZN3bar1vE")
+	== "symbol-not-regex,name-not-regex,symbol-name-not-in-set");
+  CHECK(lookup_variable(index, "", "_ZN3bar1vE")
+	== "symbol-not-regex,symbol-name-not-in-set");
+}
+
+TEST_CASE("IndexTypeSuppressions", "[suppressions_index]")
+{
+  suppressions_type supprs;
+
+  // When a type suppression has both a name and a name regular
+  // expression, only the name is considered.
+  supprs.push_back(type_suppression_sptr
+		   (new type_suppression("name-and-regex", "^T", "S")));
+  supprs.push_back(type_suppression_sptr
+		   (new type_suppression("prefix", "^ns::", "")));
+  supprs.push_back(type_suppression_sptr
+		   (new type_suppression("suffix", "Impl$", "")));
+  supprs.push_back(type_suppression_sptr
+		   (new type_suppression("invalid-regex", "(", "")));
+  // A type suppression without any name property matches types of
+  // any name.
+  supprs.push_back(type_suppression_sptr
+		   (new type_suppression("no-name", "", "")));
+  supprs.push_back(type_suppression_sptr
+		   (new type_suppression("exact-regex", "^S$", "")));
+
+  suppressions_index index(supprs);
+  CHECK(!index.has_function_suppressions());
+  CHECK(!index.has_variable_suppressions());
+
+  CHECK(lookup_type(index, "S")
+	== "name-and-regex,invalid-regex,no-name,exact-regex");
+  CHECK(lookup_type(index, "ns::Impl")
+	== "prefix,suffix,invalid-regex,no-name");
+  CHECK(lookup_type(index, "T") == "invalid-regex,no-name");
+}
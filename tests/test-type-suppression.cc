@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// -*- Mode: C++ -*-
+//
+// Copyright (C) 2025 Red Hat, Inc.
+
+/// @file
+///
+/// This program tests how a type suppression matches the source
+/// location of types, given its "source_location_not_in" and
+/// "source_location_not_regexp" properties.
+///
+/// In particular, it checks that what the suppression remembers about
+/// the source location paths it has already seen doesn't get stale
+/// when these properties are modified, and that the suppression can
+/// be used by several threads at once.
+
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "lib/catch.hpp"
+
+#include "abg-ir.h"
+#include "abg-suppression-priv.h"
+
+using std::string;
+using std::unordered_set;
+using std::vector;
+
+using namespace abigail;
+
+using ir::location;
+using ir::location_manager;
+using suppr::type_suppression;
+
+/// Test if a type suppression suppresses the types declared in a
+/// given file.
+///
+/// @param s the type suppression to consider.
+///
+/// @param lm the location manager used to create the location of
+/// the types.
+///
+/// @param path the path to the file to consider.
+///
+/// @return true iff @p s suppresses the types declared in @p path.
+static bool
+suppresses_types_of(const type_suppression& s,
+		    location_manager& lm,
+		    const string& path)
+{
+  location loc = lm.create_new_location(path, 1, 1);
+  return suppr::suppression_matches_type_location(s, loc);
+}
+
+TEST_CASE("KeptSourceLocations", "[type_suppression]")
+{
+  location_manager lm;
+  type_suppression s("public-headers", "", "");
+  s.set_source_location_to_keep_regex_str("^/usr/include/");
+  unordered_set<string>& kept = s.get_source_locations_to_keep();
+  kept.insert("foo.h");
+
+  CHECK(!suppresses_types_of(s, lm, "/src/foo.h"));
+  CHECK(suppresses_types_of(s, lm, "/src/bar.h"));
+  CHECK(!suppresses_types_of(s, lm, "/usr/include/bar.h"));
+
+  // Modifying the set of kept files through the reference obtained
+  // before the queries above is taken into account.
+  kept.insert("bar.h");
+  kept.erase("foo.h");
+  CHECK(suppresses_types_of(s, lm, "/src/foo.h"));
+  CHECK(!suppresses_types_of(s, lm, "/src/bar.h"));
+  CHECK(!suppresses_types_of(s, lm, "/usr/include/bar.h"));
+
+  // Likewise when the set is replaced.
+  s.set_source_locations_to_keep(unordered_set<string>({"/src/foo.h"}));
+  CHECK(!suppresses_types_of(s, lm, "/src/foo.h"));
+  CHECK(suppresses_types_of(s, lm, "/src/bar.h"));
+}
+
+TEST_CASE("ConcurrentKeptSourceLocations", "[type_suppression]")
+{
+  location_manager lm;
+  type_suppression s("public-headers", "", "");
+  s.set_source_location_to_keep_regex_str("^/usr/include/");
+  s.get_source_locations_to_keep().insert("foo.h");
+
+  // The locations are created beforehand as the location manager is
+  // not meant to be used by several threads.
+  const vector<string> paths =
+    {"/src/foo.h", "/src/bar.h", "/usr/include/foo.h", "/usr/include/bar.h"};
+  vector<location> locs;
+  for (const string& path : paths)
+    locs.push_back(lm.create_new_location(path, 1, 1));
+
+  const size_t num_threads = 4;
+  vector<unsigned> num_suppressed(num_threads, 0);
+  vector<std::thread> threads;
+  for (size_t t = 0; t < num_threads; ++t)
+    threads.push_back(std::thread([&s, &locs, &num_suppressed, t]()
+      {
+	for (size_t i = 0; i < 1000; ++i)
+	  for (const location& loc : locs)
+	    if (suppr::suppression_matches_type_location(s, loc))
+	      ++num_suppressed[t];
+      }));
+  for (std::thread& t : threads)
+    t.join();
+
+  // Only the types declared in /src/bar.h are suppressed.
+  for (unsigned n : num_suppressed)
+    CHECK(n == 1000);
+}
@@ -14,6 +14,7 @@
 #include <string>
 #include <vector>
 #include <set>
+#include <unordered_map>
 #include "abg-config.h"
 #include "abg-comp-filter.h"
 #include "abg-suppression.h"
@@ -101,6 +102,8 @@ struct options
   bool			show_relative_offset_changes;
   bool			show_stats_only;
   bool			show_symtabs;
+  bool			quick_check;
+  bool			reload_suppressions;
   bool			show_deleted_fns;
   bool			show_changed_fns;
   bool			show_added_fns;
@@ -162,6 +165,8 @@ struct options
       show_relative_offset_changes(true),
       show_stats_only(),
       show_symtabs(),
+      quick_check(),
+      reload_suppressions(),
       show_deleted_fns(),
       show_changed_fns(),
       show_added_fns(),
@@ -244,6 +249,10 @@ display_usage(const string& prog_name, ostream& out)
        "linux kernel abi whitelist\n"
     << " --stat  only display the diff stats\n"
     << " --symtabs  only display the symbol tables of the corpora\n"
+    << " --quick-check  only compute the exit status, without "
+    "emitting any report\n"
+    << " --reload-suppressions  for each line read from standard input, "
+    "re-read the suppression files and emit the report again\n"
     << " --no-default-suppression  don't load any "
        "default suppression specification\n"
     << " --no-architecture  do not take architecture in account\n"
@@ -523,6 +532,10 @@ parse_command_line(int argc, char* argv[], options& opts)
 	opts.show_stats_only = true;
       else if (!strcmp(argv[i], "--symtabs"))
 	opts.show_symtabs = true;
+      else if (!strcmp(argv[i], "--quick-check"))
+	opts.quick_check = true;
+      else if (!strcmp(argv[i], "--reload-suppressions"))
+	opts.reload_suppressions = true;
       else if (!strcmp(argv[i], "--help")
 	       || !strcmp(argv[i], "-h"))
 	{
@@ -831,6 +844,56 @@ maybe_check_suppression_files(const options& opts)
   return true;
 }
 
+/// Set the suppression specifications of a diff context from the
+/// @ref options data structure.
+///
+/// The suppression specification files are read, and suppression
+/// specifications are generated from the public headers, if any.
+///
+/// @param ctxt the diff context to update.
+///
+/// @param opts the instance of @ref options to consider.
+static void
+set_diff_context_suppressions(diff_context_sptr ctxt,
+			      const options& opts)
+{
+  suppressions_type supprs;
+  for (vector<string>::const_iterator i = opts.suppression_paths.begin();
+       i != opts.suppression_paths.end();
+       ++i)
+    read_suppressions(*i, supprs);
+  ctxt->add_suppressions(supprs);
+
+  if (!opts.no_default_supprs && opts.suppression_paths.empty())
+    {
+      // Load the default system and user suppressions.
+      suppressions_type& supprs = ctxt->suppressions();
+
+      load_default_system_suppressions(supprs);
+      load_default_user_suppressions(supprs);
+    }
+
+  if (!opts.headers_dirs1.empty() || !opts.header_files1.empty())
+    {
+      // Generate suppression specification to avoid showing ABI
+      // changes on types that are not defined in public headers.
+      suppression_sptr suppr =
+	gen_suppr_spec_from_headers(opts.headers_dirs1, opts.header_files1);
+      if (suppr)
+	ctxt->add_suppression(suppr);
+    }
+
+  if (!opts.headers_dirs2.empty() || !opts.header_files2.empty())
+    {
+      // Generate suppression specification to avoid showing ABI
+      // changes on types that are not defined in public headers.
+      suppression_sptr suppr =
+	gen_suppr_spec_from_headers(opts.headers_dirs2, opts.header_files2);
+      if (suppr)
+	ctxt->add_suppression(suppr);
+    }
+}
+
 /// Update the diff context from the @ref options data structure.
 ///
 /// @param ctxt the diff context to update.
@@ -884,41 +947,7 @@ set_diff_context_from_opts(diff_context_sptr ctxt,
   if (!opts.show_harmful_changes)
     ctxt->switch_categories_off(get_default_harmful_categories_bitmap());
 
-  suppressions_type supprs;
-  for (vector<string>::const_iterator i = opts.suppression_paths.begin();
-       i != opts.suppression_paths.end();
-       ++i)
-    read_suppressions(*i, supprs);
-  ctxt->add_suppressions(supprs);
-
-  if (!opts.no_default_supprs && opts.suppression_paths.empty())
-    {
-      // Load the default system and user suppressions.
-      suppressions_type& supprs = ctxt->suppressions();
-
-      load_default_system_suppressions(supprs);
-      load_default_user_suppressions(supprs);
-    }
-
-  if (!opts.headers_dirs1.empty() || !opts.header_files1.empty())
-    {
-      // Generate suppression specification to avoid showing ABI
-      // changes on types that are not defined in public headers.
-      suppression_sptr suppr =
-	gen_suppr_spec_from_headers(opts.headers_dirs1, opts.header_files1);
-      if (suppr)
-	ctxt->add_suppression(suppr);
-    }
-
-  if (!opts.headers_dirs2.empty() || !opts.header_files2.empty())
-    {
-      // Generate suppression specification to avoid showing ABI
-      // changes on types that are not defined in public headers.
-      suppression_sptr suppr =
-	gen_suppr_spec_from_headers(opts.headers_dirs2, opts.header_files2);
-      if (suppr)
-	ctxt->add_suppression(suppr);
-    }
+  set_diff_context_suppressions(ctxt, opts);
 
   ctxt->dump_diff_tree(opts.dump_diff_tree);
 
@@ -1281,6 +1310,188 @@ display_dependencies(const string& prog_name,
     }
 }
 
+/// Test if two sets of ELF symbols are made of equal symbols.
+///
+/// @param syms1 the first set of symbols to consider.  It must be
+/// sorted.
+///
+/// @param syms2 the second set of symbols to consider.  It must be
+/// sorted the same way as @p syms1.
+///
+/// @return true iff @p syms1 and @p syms2 are equal.
+static bool
+elf_symbols_are_equal(const abigail::ir::elf_symbols& syms1,
+		      const abigail::ir::elf_symbols& syms2)
+{
+  if (syms1.size() != syms2.size())
+    return false;
+
+  for (auto i = syms1.begin(), j = syms2.begin(); i != syms1.end(); ++i, ++j)
+    if (**i != **j)
+      return false;
+
+  return true;
+}
+
+/// Quickly test if two corpora have the same ABI, without building
+/// the diff graph of the two corpora.
+///
+/// This compares the exported symbols of the two corpora, and then
+/// the exported functions and variables, matched by ID.  The two
+/// corpora can be corpus groups, as is the case when comparing Linux
+/// Kernel trees.  As types are canonicalized, comparing the functions
+/// and variables boils down to comparing the canonical types of their
+/// sub-types, in the common case.
+///
+/// Note that a "false" result doesn't mean the two corpora have ABI
+/// changes, as those changes might be suppressed.  It only means that
+/// a full comparison is needed.
+///
+/// @param c1 the first corpus to consider.
+///
+/// @param c2 the second corpus to consider.
+///
+/// @param opts the options of the current program.
+///
+/// @return true if the two corpora are known to have the same ABI.
+static bool
+corpora_have_same_abi(const corpus_sptr& c1,
+		      const corpus_sptr& c2,
+		      const options& opts)
+{
+  // Changes to types that are not reachable from the exported
+  // interfaces are not looked at by this quick check.
+  if (opts.show_all_types)
+    return false;
+
+  if (!opts.ignore_soname && c1->get_soname() != c2->get_soname())
+    return false;
+
+  if (c1->get_architecture_name() != c2->get_architecture_name())
+    return false;
+
+  if (!elf_symbols_are_equal(c1->get_sorted_fun_symbols(),
+			     c2->get_sorted_fun_symbols())
+      || !elf_symbols_are_equal(c1->get_sorted_var_symbols(),
+				c2->get_sorted_var_symbols())
+      || !elf_symbols_are_equal(c1->get_unreferenced_function_symbols(),
+				c2->get_unreferenced_function_symbols())
+      || !elf_symbols_are_equal(c1->get_unreferenced_variable_symbols(),
+				c2->get_unreferenced_variable_symbols()))
+    return false;
+
+  if (c1->get_functions().size() != c2->get_functions().size()
+      || c1->get_variables().size() != c2->get_variables().size())
+    return false;
+
+  // The functions and variables of the second corpus are indexed
+  // here rather than looked up with corpus::lookup_functions and
+  // corpus::lookup_variables, as these don't look into the corpora
+  // of a corpus group.
+  std::unordered_multimap<string, const abigail::ir::function_decl*> fns;
+  for (auto f : c2->get_functions())
+    fns.emplace(f->get_id(), f);
+
+  for (auto f : c1->get_functions())
+    {
+      bool found = false;
+      auto range = fns.equal_range(f->get_id());
+      for (auto i = range.first; i != range.second; ++i)
+	if (*f == *i->second)
+	  {
+	    found = true;
+	    break;
+	  }
+      if (!found)
+	return false;
+    }
+
+  std::unordered_multimap<string, const abigail::ir::var_decl*> vars;
+  for (auto& v : c2->get_variables())
+    vars.emplace(v->get_id(), v.get());
+
+  for (auto& v : c1->get_variables())
+    {
+      bool found = false;
+      auto range = vars.equal_range(v->get_id());
+      for (auto i = range.first; i != range.second; ++i)
+	if (*v == *i->second)
+	  {
+	    found = true;
+	    break;
+	  }
+      if (!found)
+	return false;
+    }
+
+  return true;
+}
+
+/// For each line read from the standard input, read the suppression
+/// specification files again, apply them to the changes that were
+/// already computed, and emit the report again.
+///
+/// This lets users iterate on their suppression specifications
+/// without reading the input binaries and computing their changes
+/// again.
+///
+/// @param diff the changes to apply the suppression specifications
+/// to.
+///
+/// @param opts the options of the current program.
+///
+/// @param status the exit status of the program before this function
+/// is invoked.
+///
+/// @return the exit status of the program for the last set of
+/// suppression specifications that was applied.
+static abidiff_status
+reload_suppressions_on_input(const corpus_diff_sptr& diff,
+			     const options& opts,
+			     abidiff_status status)
+{
+  diff_context_sptr ctxt = diff->context();
+  string line;
+  while (std::getline(std::cin, line))
+    {
+      if (!maybe_check_suppression_files(opts))
+	{
+	  status = (abigail::tools_utils::ABIDIFF_USAGE_ERROR
+		    | abigail::tools_utils::ABIDIFF_ERROR);
+	  continue;
+	}
+
+      tools_utils::timer t;
+      if (opts.do_log)
+	{
+	  t.start();
+	  std::cerr << "Re-applying suppressions ...\n";
+	}
+
+      ctxt->suppressions().clear();
+      set_diff_context_suppressions(ctxt, opts);
+      diff->reapply_filters_and_suppressions();
+
+      if (opts.do_log)
+	{
+	  t.stop();
+	  std::cerr << "suppressions re-applied!:" << t << "\n";
+	}
+
+      status = abigail::tools_utils::ABIDIFF_OK;
+      if (diff->has_net_changes())
+	status = abigail::tools_utils::ABIDIFF_ABI_CHANGE;
+      if (diff->has_incompatible_changes())
+	status |= abigail::tools_utils::ABIDIFF_ABI_INCOMPATIBLE_CHANGE;
+
+      if (!opts.quick_check && diff->has_changes())
+	diff->report(cout);
+      cout << std::flush;
+    }
+
+  return status;
+}
+
 int
 main(int argc, char* argv[])
 {
@@ -1661,6 +1872,37 @@ main(int argc, char* argv[])
 
 	  adjust_diff_context_for_kmidiff(*ctxt);
 	  tools_utils::timer t;
+	  if (opts.quick_check)
+	    {
+	      if (opts.do_log)
+		{
+		  t.start();
+		  std::cerr << "Quickly comparing the corpus groups ...\n";
+		}
+
+	      bool same_abi = corpora_have_same_abi(g1, g2, opts);
+
+	      if (opts.do_log)
+		{
+		  t.stop();
+		  std::cerr << "corpus groups quickly compared!:" << t << "\n";
+		}
+
+	      if (same_abi && !opts.reload_suppressions)
+		{
+		  // There is no need to compute the diff, but the
+		  // dependencies still have to be listed.
+		  if (opts.list_dependencies)
+		    {
+		      set<string> deps1, deps2;
+		      get_dependencies(*c1, opts.added_bins_dirs1, deps1);
+		      get_dependencies(*c2, opts.added_bins_dirs2, deps2);
+		      display_dependencies(argv[0], c1, c2, deps1, deps2);
+		    }
+		  return abigail::tools_utils::ABIDIFF_OK;
+		}
+	    }
+
 	  if (opts.do_log)
 	    {
 	      t.start();
@@ -1711,7 +1953,7 @@ main(int argc, char* argv[])
 	      std::cerr << "Computing changes ...\n";
 	    }
 
-	  if (diff->has_changes())
+	  if (!opts.quick_check && diff->has_changes())
 	    {
 	      if (opts.do_log)
 		{
@@ -1742,6 +1984,9 @@ main(int argc, char* argv[])
 		}
 	    }
 
+	  if (opts.reload_suppressions)
+	    status = reload_suppressions_on_input(diff, opts, status);
+
 	  if (opts.list_dependencies)
 	    {
 	      set<string> deps1, deps2;
@@ -1782,6 +2027,26 @@ main(int argc, char* argv[])
 	  set_corpus_keep_drop_regex_patterns(opts, c2);
 
 	  tools_utils::timer t;
+	  if (opts.quick_check)
+	    {
+	      if (opts.do_log)
+		{
+		  t.start();
+		  std::cerr << "Quickly comparing the corpora ...\n";
+		}
+
+	      bool same_abi = corpora_have_same_abi(c1, c2, opts);
+
+	      if (opts.do_log)
+		{
+		  t.stop();
+		  std::cerr << "corpora quickly compared!:" << t << "\n";
+		}
+
+	      if (same_abi && !opts.reload_suppressions)
+		return abigail::tools_utils::ABIDIFF_OK;
+	    }
+
 	  if (opts.do_log)
 	    {
 	      t.start();
@@ -1834,7 +2099,7 @@ main(int argc, char* argv[])
 	      std::cerr << "Computing changes ...\n";
 	    }
 
-	  if (diff->has_changes())
+	  if (!opts.quick_check && diff->has_changes())
 	    {
 	      if (opts.do_log)
 		{
@@ -1856,6 +2121,9 @@ main(int argc, char* argv[])
 		  std::cerr << "Report computed!:" << t << "\n";
 		}
 	    }
+
+	  if (opts.reload_suppressions)
+	    status = reload_suppressions_on_input(diff, opts, status);
 	}
       else
 	status = abigail::tools_utils::ABIDIFF_ERROR;
@@ -60,6 +60,8 @@ using abigail::tools_utils::stick_corpus_and_binaries_into_corpus_group;
 using abigail::tools_utils::add_dependencies_into_corpus_group;
 using abigail::ir::environment_sptr;
 using abigail::ir::environment;
+using abigail::ir::memory_stats_type;
+using abigail::ir::dump_memory_stats;
 using abigail::corpus;
 using abigail::corpus_sptr;
 using abigail::translation_units;
@@ -112,6 +114,7 @@ struct options
   bool			linux_kernel_mode;
   bool			corpus_group_for_linux;
   bool			show_stats;
+  bool			show_mem_stats;
   bool			noout;
   bool			follow_dependencies;
   bool			list_dependencies;
@@ -160,6 +163,7 @@ struct options
       linux_kernel_mode(true),
       corpus_group_for_linux(false),
       show_stats(),
+      show_mem_stats(),
       noout(),
       follow_dependencies(),
       list_dependencies(),
@@ -241,6 +245,8 @@ display_usage(const string& prog_name, ostream& out)
     "vmlinux and its modules\n"
     << "  --load-all-types  read all types including those not reachable from "
     "exported declarations\n"
+    << "  --mem-stats  show the approximate memory used by the internal "
+    "representation\n"
     << "  --no-architecture  do not emit architecture info in the output\n"
     << "  --no-assume-odr-for-cplusplus  do not assume the ODR to speed-up the "
     "analysis of the binary\n"
@@ -493,6 +499,8 @@ parse_command_line(int argc, char* argv[], options& opts)
 	opts.annotate = true;
       else if (!strcmp(argv[i], "--stats"))
 	opts.show_stats = true;
+      else if (!strcmp(argv[i], "--mem-stats"))
+	opts.show_mem_stats = true;
       else if (!strcmp(argv[i], "--verbose"))
 	opts.do_log = true;
       else if (!strcmp(argv[i], "--help")
@@ -908,6 +916,20 @@ load_corpus_and_write_abixml(char* argv[],
       return 1;
     }
 
+  if (opts.show_mem_stats)
+    {
+      // Show the approximate memory used by the IR of the corpus, by
+      // the environment and by the side tables of the reader.
+      memory_stats_type stats;
+      corp->record_memory_stats(stats);
+      env.record_memory_stats(stats);
+      reader->record_memory_stats(stats);
+      emit_prefix(argv[0], cerr)
+	<< "memory used by the internal representation of '"
+	<< opts.in_file_path << "':\n";
+      dump_memory_stats(stats, cerr);
+    }
+
   if (opts.list_dependencies)
     {
       // Show the dependencies of the corpus and display them.
@@ -102,6 +102,7 @@ using std::cerr;
 using std::string;
 using std::ostream;
 using std::ofstream;
+using std::ifstream;
 using std::vector;
 using std::map;
 using std::unordered_set;
@@ -1490,6 +1491,109 @@ emit_alt_debug_info_not_found_error(abigail::elf_based_reader&	reader,
     << "debug info file, using an additional --d1/--d2 switch\n";
 }
 
+/// Test if two files have the same content.
+///
+/// @param path1 the path to the first file to consider.
+///
+/// @param path2 the path to the second file to consider.
+///
+/// @return true iff the files at @p path1 and @p path2 have the same
+/// bytes.
+static bool
+files_are_identical(const string& path1, const string& path2)
+{
+  ifstream in1(path1, std::ios::binary), in2(path2, std::ios::binary);
+  if (!in1 || !in2)
+    return false;
+
+  const size_t buf_size = 64 * 1024;
+  vector<char> buf1(buf_size), buf2(buf_size);
+  while (in1 && in2)
+    {
+      in1.read(buf1.data(), buf_size);
+      in2.read(buf2.data(), buf_size);
+      std::streamsize n = in1.gcount();
+      if (n != in2.gcount()
+	  || memcmp(buf1.data(), buf2.data(), n) != 0)
+	return false;
+    }
+
+  return in1.eof() && in2.eof();
+}
+
+/// Test if two ELF files have the same content.
+///
+/// @param elf1 the first ELF file to consider.
+///
+/// @param elf2 the second ELF file to consider.
+///
+/// @return true iff @p elf1 and @p elf2 have the same size and the
+/// same bytes.
+static bool
+elf_files_are_identical(const elf_file& elf1, const elf_file& elf2)
+{
+  if (elf1.size != elf2.size)
+    return false;
+
+  return files_are_identical(elf1.path, elf2.path);
+}
+
+/// Test if two identical ELF files have identical DWARF debug info.
+///
+/// Two identical stripped binaries can come with different split
+/// debug info files, e.g, when only the debug info package was
+/// rebuilt.  So the split debug info files found for the two ELF
+/// files must be identical as well.
+///
+/// Note that an alternate debug info file created by the 'DWZ' tool
+/// is designated by its build ID from the debug info file that refers
+/// to it.  So identical debug info files refer to identical alternate
+/// debug info files.
+///
+/// @param elf1 the first ELF file to consider.
+///
+/// @param debug_dir1 the directory where the debug info file for @p
+/// elf1 is stored.
+///
+/// @param elf2 the second ELF file to consider.  It must have the
+/// same content as @p elf1.
+///
+/// @param debug_dir2 the directory where the debug info file for @p
+/// elf2 is stored.
+///
+/// @param env the environment to use to look for the debug info.
+///
+/// @return true iff the debug info of @p elf1 and @p elf2 is
+/// identical.
+static bool
+debug_info_is_identical(const elf_file&	elf1,
+			const string&		debug_dir1,
+			const elf_file&	elf2,
+			const string&		debug_dir2,
+			abigail::ir::environment&	env)
+{
+  // Without any debug info package, the debug info, if any, is in
+  // the ELF files themselves.
+  if (debug_dir1.empty() && debug_dir2.empty())
+    return true;
+
+  vector<string> di_dirs1, di_dirs2;
+  if (!debug_dir1.empty())
+    di_dirs1.push_back(debug_dir1);
+  if (!debug_dir2.empty())
+    di_dirs2.push_back(debug_dir2);
+
+  abigail::elf::reader reader1(elf1.path, di_dirs1, env);
+  abigail::elf::reader reader2(elf2.path, di_dirs2, env);
+  const string& di_path1 = reader1.dwarf_debug_info_path();
+  const string& di_path2 = reader2.dwarf_debug_info_path();
+
+  if (di_path1.empty() || di_path2.empty())
+    return di_path1.empty() && di_path2.empty();
+
+  return files_are_identical(di_path1, di_path2);
+}
+
 /// Compare the ABI two elf files, using their associated debug info.
 ///
 /// The result of the comparison is emitted to standard output.
@@ -1566,6 +1670,21 @@ compare(const elf_file&		elf1,
       return abigail::tools_utils::ABIDIFF_OK;
     }
 
+  // Binaries that didn't change from one package to the other are
+  // common.  There is no need to read their debug info and compare
+  // their ABIs, unless their split debug info changed.
+  if (elf_files_are_identical(elf1, elf2)
+      && debug_info_is_identical(elf1, debug_dir1, elf2, debug_dir2, env))
+    {
+      if (opts.verbose)
+	emit_prefix("abipkgdiff", cerr)
+	  << "  input files "
+	  << elf1.path << " and " << elf2.path
+	  << " and their debug info are identical."
+	  << "  Not reading any of them\n";
+      return abigail::tools_utils::ABIDIFF_OK;
+    }
+
   // Add the first private type suppressions set to the set of
   // suppressions.
   for (suppressions_type::const_iterator i = priv_types_supprs1.begin();